@@ -21,6 +21,7 @@
 
 #include <map>
 #include <string>
+#include <cstdlib>
 #include <BitBoson/HiggsBoson/HiggsBoson.h>
 #include <BitBoson/HiggsBoson/Utils/Utils.h>
 #include <BitBoson/HiggsBoson/Utils/ExecShell.h>
@@ -56,6 +57,7 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
     auto projectSource = root["project"]["source"].As<std::string>();
     auto projectTest = root["project"]["test"].As<std::string>();
     auto projectMain = root["project"]["main"].As<std::string>();
+    auto projectBenchmark = root["project"]["benchmark"].As<std::string>();
 
     // Read-in the various targets provided in the Project Settings
     auto configuredTargetsYaml = root["project"]["targets"];
@@ -66,6 +68,17 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
     if (std::find(_configuredTargets.begin(), _configuredTargets.end(), "default") == _configuredTargets.end())
         _configuredTargets.push_back("default");
 
+    // Read-in the link-time optimization mode (off, thin, or full) for each target
+    // NOTE: Target-specific values ("target <name>") override the project-wide value
+    std::map<std::string, std::string> ltoModes;
+    for (const auto& target : _configuredTargets)
+    {
+        auto ltoMode = getConfigurationForTarget(root["build"], target)["lto"].As<std::string>();
+        if (ltoMode.empty())
+            ltoMode = root["build"]["lto"].As<std::string>();
+        ltoModes[target] = (((ltoMode == "thin") || (ltoMode == "full")) ? ltoMode : "off");
+    }
+
     // Create and setup the project settings object
     ProjectSettings::ProjectType projectTypeEnum = ProjectSettings::ProjectType::TYPE_LIB;
     if (projectType == "exe")
@@ -79,6 +92,15 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
     HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + peruDir);
     _peruSettings = std::make_shared<PeruSettings>(peruFile, peruDir);
 
+    // Read-in the download backend (downloading git/curl dependencies natively if selected)
+    auto downloadBackendYaml = root["download"]["backend"].As<std::string>();
+    auto downloadJobsYaml = root["download"]["jobs"].As<std::string>();
+    auto downloadRetriesYaml = root["download"]["retries"].As<std::string>();
+    if (downloadBackendYaml == "native")
+        _peruSettings->setNativeDownloads(true,
+                downloadJobsYaml.empty() ? 4 : static_cast<unsigned int>(std::strtoul(downloadJobsYaml.c_str(), nullptr, 10)),
+                downloadRetriesYaml.empty() ? 3 : static_cast<unsigned int>(std::strtoul(downloadRetriesYaml.c_str(), nullptr, 10)));
+
     // Read-in the YAML configuration for the Dependencies
     auto depsListYaml = root["dependencies"];
     if (depsListYaml.Size() > 0)
@@ -106,6 +128,15 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
                     _peruSettings->addDependency(depName, PeruSettings::DependencyType::TYPE_GIT);
                     _peruSettings->addDependencyProperty(depName, "url", depsYaml["url"].As<std::string>());
                     _peruSettings->addDependencyProperty(depName, "rev", depsYaml["rev"].As<std::string>());
+                    _peruSettings->addDependencyProperty(depName, "filter", depsYaml["filter"].As<std::string>());
+
+                    // Collect the sparse-checkout patterns (comma-separated) for the dependency
+                    std::string sparsePaths;
+                    auto sparsePathsYaml = depsYaml["paths"];
+                    if (sparsePathsYaml.Size() > 0)
+                        for(auto pathIter = sparsePathsYaml.Begin(); pathIter != sparsePathsYaml.End(); pathIter++)
+                            sparsePaths += (sparsePaths.empty() ? "" : ",") + (*pathIter).second.As<std::string>();
+                    _peruSettings->addDependencyProperty(depName, "paths", sparsePaths);
                 }
 
                 // Process "curl" dependencies
@@ -117,6 +148,7 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
                     _peruSettings->addDependency(depName, PeruSettings::DependencyType::TYPE_CURL);
                     _peruSettings->addDependencyProperty(depName, "url", depsYaml["url"].As<std::string>());
                     _peruSettings->addDependencyProperty(depName, "unpack", depsYaml["unpack"].As<std::string>());
+                    _peruSettings->addDependencyProperty(depName, "sha256", depsYaml["sha256"].As<std::string>());
                 }
 
                 // Create a new dependency object to add to the list
@@ -154,6 +186,15 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
                                 buildSteps.push_back("CXX=/usr/bin/clang++");
                             }
 
+                            // Define the link-time optimization flags for the dependency to use
+                            // NOTE: ThinLTO requires clang, which is only guaranteed for the default target
+                            if (ltoModes[target] == "off")
+                                buildSteps.push_back("LTO_FLAGS=");
+                            else if ((ltoModes[target] == "thin") && (target == "default"))
+                                buildSteps.push_back("LTO_FLAGS=-flto=thin");
+                            else
+                                buildSteps.push_back("LTO_FLAGS=-flto");
+
                             // Iterate over the build-steps and collect them in a vector
                             auto buildStepsYaml = getConfigurationForTarget(depsYaml, target)["build"];
                             if (buildStepsYaml.Size() > 0)
@@ -254,6 +295,7 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
 
     // Setup the CMakeLists.txt file for the project
     _cMakeSettings = std::make_shared<CMakeSettings>(projectName, projectVersion, projectDir, tmpDir);
+    _cMakeSettings->setProjectDirs(projectDir + "/" + projectSource, projectDir + "/" + projectTest);
 
     // Read-in the pre-test commands for the project configuration
     auto buildCommandsYaml = root["commands"]["test"]["pre"];
@@ -279,6 +321,110 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
         for(auto cmdIter = buildCommandsYaml.Begin(); cmdIter != buildCommandsYaml.End(); cmdIter++)
             _cMakeSettings->addPostBuildCommand((*cmdIter).second.As<std::string>());
 
+    // Read-in the precompiled headers for the project configuration
+    auto buildPchYaml = root["build"]["pch"];
+    if (buildPchYaml.Size() > 0)
+        for(auto pchIter = buildPchYaml.Begin(); pchIter != buildPchYaml.End(); pchIter++)
+            _cMakeSettings->addPrecompiledHeader((*pchIter).second.As<std::string>());
+
+    // Read-in the auto-detected precompiled headers limit (if provided)
+    auto buildPchAutoYaml = root["build"]["pch-auto"].As<std::string>();
+    if (!buildPchAutoYaml.empty())
+        _cMakeSettings->setPrecompiledHeadersLimit(
+                static_cast<unsigned int>(std::strtoul(buildPchAutoYaml.c_str(), nullptr, 10)));
+
+    // Setup the link-time optimization modes for the project's targets
+    for (const auto& ltoMode : ltoModes)
+        _cMakeSettings->setLinkTimeOptimization(ltoMode.first, ltoMode.second);
+
+    // Read-in the build profiles (build-type and compile/link flags) for each target
+    // NOTE: Target-specific ("target <name>") flags are appended after the profile-wide
+    //       flags so they take precedence, and the build-type defaults to "Release"
+    auto profilesYaml = root["profiles"];
+    if (profilesYaml.Size() > 0)
+    {
+        for (auto profileIter = profilesYaml.Begin(); profileIter != profilesYaml.End(); profileIter++)
+        {
+            auto profileName = (*profileIter).first;
+            auto& profileYaml = (*profileIter).second;
+            for (const auto& target : _configuredTargets)
+            {
+
+                // Read-in the build-type for the profile's target
+                auto targetProfileYaml = getConfigurationForTarget(profileYaml, target);
+                auto buildType = targetProfileYaml["build-type"].As<std::string>();
+                if (buildType.empty())
+                    buildType = profileYaml["build-type"].As<std::string>();
+                if (buildType.empty())
+                    buildType = "Release";
+
+                // Read-in the compile flags for the profile's target
+                std::vector<std::string> compileFlags;
+                auto compileFlagsYaml = profileYaml["compile"];
+                if (compileFlagsYaml.Size() > 0)
+                    for (auto flagIter = compileFlagsYaml.Begin(); flagIter != compileFlagsYaml.End(); flagIter++)
+                        compileFlags.push_back((*flagIter).second.As<std::string>());
+                compileFlagsYaml = targetProfileYaml["compile"];
+                if (compileFlagsYaml.Size() > 0)
+                    for (auto flagIter = compileFlagsYaml.Begin(); flagIter != compileFlagsYaml.End(); flagIter++)
+                        compileFlags.push_back((*flagIter).second.As<std::string>());
+
+                // Read-in the link flags for the profile's target
+                std::vector<std::string> linkFlags;
+                auto linkFlagsYaml = profileYaml["link"];
+                if (linkFlagsYaml.Size() > 0)
+                    for (auto flagIter = linkFlagsYaml.Begin(); flagIter != linkFlagsYaml.End(); flagIter++)
+                        linkFlags.push_back((*flagIter).second.As<std::string>());
+                linkFlagsYaml = targetProfileYaml["link"];
+                if (linkFlagsYaml.Size() > 0)
+                    for (auto flagIter = linkFlagsYaml.Begin(); flagIter != linkFlagsYaml.End(); flagIter++)
+                        linkFlags.push_back((*flagIter).second.As<std::string>());
+
+                // Add the build profile for the target
+                _cMakeSettings->addBuildProfile(profileName, target, buildType, compileFlags, linkFlags);
+            }
+        }
+    }
+
+    // Read-in the linker (if provided and valid, otherwise the default linker is used)
+    auto buildLinkerYaml = root["build"]["linker"].As<std::string>();
+    if ((buildLinkerYaml == "default") || (buildLinkerYaml == "lld")
+            || (buildLinkerYaml == "mold") || (buildLinkerYaml == "gold"))
+        _cMakeSettings->setLinker(buildLinkerYaml);
+
+    // Read-in the debug information mode (if provided and valid, otherwise full)
+    auto buildDebugInfoYaml = root["build"]["debug-info"].As<std::string>();
+    if ((buildDebugInfoYaml == "full") || (buildDebugInfoYaml == "split")
+            || (buildDebugInfoYaml == "compressed") || (buildDebugInfoYaml == "none"))
+        _cMakeSettings->setDebugInfo(buildDebugInfoYaml);
+
+    // Read-in the profile-guided optimization training workload (if provided)
+    // NOTE: A command ("run") takes precedence over a benchmark filter ("bench")
+    //       which takes precedence over a test filter ("test")
+    auto buildPgoRunYaml = root["build"]["pgo"]["run"].As<std::string>();
+    auto buildPgoBenchYaml = root["build"]["pgo"]["bench"].As<std::string>();
+    auto buildPgoTestYaml = root["build"]["pgo"]["test"].As<std::string>();
+    if (!buildPgoRunYaml.empty())
+        _cMakeSettings->setOptimizationWorkload("run", buildPgoRunYaml);
+    else if (!buildPgoBenchYaml.empty())
+        _cMakeSettings->setOptimizationWorkload("bench", buildPgoBenchYaml);
+    else if (!buildPgoTestYaml.empty())
+        _cMakeSettings->setOptimizationWorkload("test", buildPgoTestYaml);
+
+    // Read-in the number of test shards (if provided)
+    auto buildTestShardsYaml = root["build"]["test-shards"].As<std::string>();
+    if (!buildTestShardsYaml.empty())
+        _cMakeSettings->setTestShards(
+                static_cast<unsigned int>(std::strtoul(buildTestShardsYaml.c_str(), nullptr, 10)));
+
+    // Read-in the benchmark regression gate (if provided)
+    auto buildBenchThresholdYaml = root["build"]["bench-threshold"].As<std::string>();
+    auto buildBenchSignificanceYaml = root["build"]["bench-significance"].As<std::string>();
+    if (!buildBenchThresholdYaml.empty() || !buildBenchSignificanceYaml.empty())
+        _cMakeSettings->setBenchmarkRegressionGate(
+                buildBenchThresholdYaml.empty() ? 5.0 : std::strtod(buildBenchThresholdYaml.c_str(), nullptr),
+                buildBenchSignificanceYaml.empty() ? 0.05 : std::strtod(buildBenchSignificanceYaml.c_str(), nullptr));
+
     // Add-in the C++ source files for the project
     // TODO - Normpath required here
     for (const auto& sourceFile : Utils::listFilesInDirectory(projectDir + "/" + projectSource))
@@ -303,6 +449,14 @@ Configuration::Configuration(const std::string& projectDir, const std::string& f
                 || (Utils::splitStringByDelimiter(testingFile, '.').back() == "hxx")
                 || (Utils::splitStringByDelimiter(testingFile, '.').back() == "hpp"))
             _cMakeSettings->addTestingFile(testingFile);
+
+    // Add-in the C++ benchmark files for the project (if provided)
+    if (!projectBenchmark.empty())
+        for (const auto& benchmarkFile : Utils::listFilesInDirectory(projectDir + "/" + projectBenchmark))
+            if ((Utils::splitStringByDelimiter(benchmarkFile, '.').back() == "h")
+                    || (Utils::splitStringByDelimiter(benchmarkFile, '.').back() == "hxx")
+                    || (Utils::splitStringByDelimiter(benchmarkFile, '.').back() == "hpp"))
+                _cMakeSettings->addBenchmarkFile(benchmarkFile);
 }
 
 /**
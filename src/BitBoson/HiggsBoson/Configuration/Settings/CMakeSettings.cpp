@@ -19,10 +19,24 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <map>
+#include <cmath>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
 #include <stdlib.h>
+#include <algorithm>
 #include <BitBoson/HiggsBoson/HiggsBoson.h>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
 #include <BitBoson/HiggsBoson/Utils/ExecShell.h>
 #include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Utils/IncludeGraph.h>
+#include <BitBoson/HiggsBoson/Utils/PerfCounters.h>
+#include <BitBoson/HiggsBoson/Utils/TimeTraceProfile.h>
+#include <BitBoson/HiggsBoson/Utils/FlameGraph.h>
+#include <BitBoson/HiggsBoson/Utils/OffCpuProfile.h>
+#include <BitBoson/HiggsBoson/Utils/CachegrindProfile.h>
 #include <BitBoson/HiggsBoson/Configuration/Settings/CMakeSettings.h>
 
 using namespace BitBoson;
@@ -48,6 +62,15 @@ CMakeSettings::CMakeSettings(const std::string& projectName,
     _cMakeBuildDir = cMakeBuildDir;
     _cMakeCacheDir = cMakeCacheDir;
     _cMakeFile = _cMakeCacheDir + "/CMakeLists.txt";
+    _sourceDir = _cMakeBuildDir + "/src";
+    _testDir = _cMakeBuildDir + "/test";
+    _precompiledHeadersLimit = 0;
+    _testShards = 0;
+    _linker = "default";
+    _debugInfo = "full";
+    _pgoWorkloadType = "test";
+    _benchRegressionThreshold = 5.0;
+    _benchSignificance = 0.05;
 
     // Ensure the build and chache directories exists
     HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + _cMakeBuildDir);
@@ -66,6 +89,21 @@ void CMakeSettings::setMainSource(const std::string& mainSource)
     _mainFile = mainSource;
 }
 
+/**
+ * Function used to set the project's source and testing directories
+ * NOTE: These default to the "src" and "test" directories of the project
+ *
+ * @param sourceDir String representing the path to the source directory
+ * @param testDir String representing the path to the testing directory
+ */
+void CMakeSettings::setProjectDirs(const std::string& sourceDir, const std::string& testDir)
+{
+
+    // Simply set the directory values
+    _sourceDir = sourceDir;
+    _testDir = testDir;
+}
+
 /**
  * Function used to add a source-file to the CMake configuration
  *
@@ -147,6 +185,33 @@ bool CMakeSettings::addTestingFile(const std::string& testingFile)
     return retFlag;
 }
 
+/**
+ * Function used to add a benchmark-file to the CMake configuration
+ *
+ * @param benchmarkFile String representing the path to the benchmark file
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CMakeSettings::addBenchmarkFile(const std::string& benchmarkFile)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the provided file does not exist already
+    if (_benchmarkFiles.find(benchmarkFile) == _benchmarkFiles.end())
+    {
+
+        // Add-in the file to the map
+        _benchmarkFiles[benchmarkFile] = true;
+
+        // Indicate that the operation was successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
 /**
  * Function used to add a pre-build command to the configuration
  *
@@ -203,8 +268,9 @@ void CMakeSettings::addPostTestCommand(const std::string& postTestCommand)
 void CMakeSettings::addLibrary(const std::string& libraryPath)
 {
 
-    // Simply add the path to the list of paths
-    _externalLibraries.push_back(libraryPath);
+    // Add the path to the list of paths (if not already added)
+    if (std::find(_externalLibraries.begin(), _externalLibraries.end(), libraryPath) == _externalLibraries.end())
+        _externalLibraries.push_back(libraryPath);
 }
 
 /**
@@ -215,37 +281,203 @@ void CMakeSettings::addLibrary(const std::string& libraryPath)
 void CMakeSettings::addIncludeDir(const std::string& includesPath)
 {
 
-    // Simply add the path to the list of paths
-    _externalIncludes.push_back(includesPath);
+    // Add the path to the list of paths (if not already added)
+    if (std::find(_externalIncludes.begin(), _externalIncludes.end(), includesPath) == _externalIncludes.end())
+        _externalIncludes.push_back(includesPath);
+}
+
+/**
+ * Function used to add a precompiled header to the configuration
+ *
+ * @param header String representing the header (<name> or path)
+ */
+void CMakeSettings::addPrecompiledHeader(const std::string& header)
+{
+
+    // Only add the header if it has not already been added
+    if (!header.empty() && (std::find(_precompiledHeaders.begin(), _precompiledHeaders.end(), header) == _precompiledHeaders.end()))
+        _precompiledHeaders.push_back(header);
+}
+
+/**
+ * Function used to set the maximum number of auto-detected
+ * (most-included) headers to precompile for the configuration
+ * NOTE: A limit of zero (the default) disables the auto-detection
+ *
+ * @param limit Unsigned Integer representing the header limit
+ */
+void CMakeSettings::setPrecompiledHeadersLimit(unsigned int limit)
+{
+
+    // Simply set the limit value
+    _precompiledHeadersLimit = limit;
+}
+
+/**
+ * Function used to set the number of test shards (translation units)
+ * to split the testing files across for the configuration
+ * NOTE: A shard count of zero sizes the shards automatically
+ *
+ * @param testShards Unsigned Integer representing the number of shards
+ */
+void CMakeSettings::setTestShards(unsigned int testShards)
+{
+
+    // Simply set the shard count value
+    _testShards = testShards;
+}
+
+/**
+ * Function used to set the link-time optimization mode for a target
+ *
+ * @param target String representing the target to set the mode for
+ * @param ltoMode String representing the mode (off, thin, or full)
+ */
+void CMakeSettings::setLinkTimeOptimization(const std::string& target, const std::string& ltoMode)
+{
+
+    // Simply set the mode for the target
+    _ltoModes[target] = ltoMode;
+}
+
+/**
+ * Function used to set the linker used for the configuration
+ * NOTE: Unavailable linkers fall back to the default linker
+ *
+ * @param linker String representing the linker (default, lld, mold, or gold)
+ */
+void CMakeSettings::setLinker(const std::string& linker)
+{
+
+    // Simply set the linker value
+    _linker = linker;
+}
+
+/**
+ * Function used to set how debug information is generated for the
+ * configuration (for the build-types which include debug information)
+ *
+ * @param debugInfo String representing the mode (full, split, compressed, or none)
+ */
+void CMakeSettings::setDebugInfo(const std::string& debugInfo)
+{
+
+    // Simply set the debug information mode
+    _debugInfo = debugInfo;
+}
+
+/**
+ * Function used to set the training workload used to generate the
+ * profile for profile-guided optimization
+ *
+ * @param workloadType String representing the workload type (run, test, or bench)
+ * @param workload String representing the command to run (run) or the
+ *                 test/benchmark filter to apply (test/bench)
+ */
+void CMakeSettings::setOptimizationWorkload(const std::string& workloadType, const std::string& workload)
+{
+
+    // Simply set the workload values
+    _pgoWorkloadType = workloadType;
+    _pgoWorkload = workload;
+}
+
+/**
+ * Function used to set the gate used when comparing benchmarks against a
+ * baseline, where a benchmark regresses if it is slower by more than the
+ * threshold with a (Mann-Whitney U) p-value below the significance level
+ *
+ * @param thresholdPercent Double representing the allowed slowdown (percent)
+ * @param significance Double representing the significance level (alpha)
+ */
+void CMakeSettings::setBenchmarkRegressionGate(double thresholdPercent, double significance)
+{
+
+    // Simply set the gate values
+    _benchRegressionThreshold = thresholdPercent;
+    _benchSignificance = significance;
+}
+
+/**
+ * Function used to add a build profile (build-type and flags) for a target
+ *
+ * @param profile String representing the name of the build profile
+ * @param target String representing the target the profile applies to
+ * @param buildType String representing the CMake build-type to use
+ * @param compileFlags Vector of Strings representing the compile flags
+ * @param linkFlags Vector of Strings representing the link flags
+ */
+void CMakeSettings::addBuildProfile(const std::string& profile, const std::string& target,
+        const std::string& buildType, const std::vector<std::string>& compileFlags,
+        const std::vector<std::string>& linkFlags)
+{
+
+    // Simply set the profile values for the target
+    _profileBuildTypes[profile][target] = buildType;
+    _profileCompileFlags[profile][target] = compileFlags;
+    _profileLinkFlags[profile][target] = linkFlags;
 }
 
 /**
  * Function used to compile/build the CMake project for the target
  *
  * @param target String representing the target to compile for
+ * @param profile String representing the build profile to use (if any)
+ * @param timeTrace Boolean indicating whether to write per translation-unit time-traces
  * @return Boolean indicating whether the operation was successful
  */
-bool CMakeSettings::buildCMakeProject(const std::string& target)
+bool CMakeSettings::buildCMakeProject(const std::string& target, const std::string& profile,
+        bool timeTrace)
 {
 
     // Create a return flag
     bool retFlag = false;
 
+    // Each build profile gets its own build directory and workflow files
+    std::string buildName = target + (profile.empty() ? "" : ("-" + profile));
+
+    // Determine the build-type and flags for the build profile (if any)
+    // NOTE: The standard CMake build-types can be used as profiles without configuration
+    bool validProfile = true;
+    std::string buildType = "Release";
+    std::vector<std::string> compileFlags;
+    std::vector<std::string> linkFlags;
+    if (!profile.empty())
+    {
+        std::map<std::string, std::string> standardBuildTypes = {{"release", "Release"},
+                {"debug", "Debug"}, {"relwithdebinfo", "RelWithDebInfo"}, {"minsizerel", "MinSizeRel"}};
+        if (_profileBuildTypes[profile].find(target) != _profileBuildTypes[profile].end())
+        {
+            buildType = _profileBuildTypes[profile][target];
+            compileFlags = _profileCompileFlags[profile][target];
+            linkFlags = _profileLinkFlags[profile][target];
+        }
+        else if (standardBuildTypes.find(profile) != standardBuildTypes.end())
+        {
+            buildType = standardBuildTypes[profile];
+        }
+        else
+        {
+            std::cout << "Unknown build profile: " << profile << std::endl;
+            validProfile = false;
+        }
+    }
+
     // Write-out the CMakeLists.txt file
-    auto wroteFile = writeCMakeFile(false);
+    auto wroteFile = (validProfile && writeCMakeFile(false));
 
     // Force a re-build by deleting the build directory itself
     // NOTE: This is a current workaround and should be removed
-    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + _cMakeCacheDir + "/builds/compile/" + target);
+    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + _cMakeCacheDir + "/builds/compile/" + buildName);
 
     // Create the build directory for CMake to actually use
     if (wroteFile && HiggsBoson::RunTypeSingleton::executeInContainer(
-        "mkdir -p " + _cMakeCacheDir + "/builds/compile/" + target))
+        "mkdir -p " + _cMakeCacheDir + "/builds/compile/" + buildName))
     {
 
         // Write the build workflow for the specified target
         bool wroteBuildFile = false;
-        auto buildFile = FileWriter(_cMakeCacheDir + "/builds/compile-" + target + ".sh");
+        auto buildFile = FileWriter(_cMakeCacheDir + "/builds/compile-" + buildName + ".sh");
         if (buildFile.isOpen())
         {
 
@@ -256,15 +488,23 @@ bool CMakeSettings::buildCMakeProject(const std::string& target)
             buildFile.writeLine("");
 
             // Write-in the standard build file information for the target
-            buildFile.writeLine("# Build Steps for the Compile operation for target " + target);
-            buildFile.writeLine("mkdir -p " + _cMakeCacheDir + "/builds/compile/" + target);
-            buildFile.writeLine("cd " + _cMakeCacheDir + "/builds/compile/" + target);
+            buildFile.writeLine("# Build Steps for the Compile operation for target " + target
+                    + (profile.empty() ? "" : (" (profile " + profile + ")")));
+            buildFile.writeLine("mkdir -p " + _cMakeCacheDir + "/builds/compile/" + buildName);
+            buildFile.writeLine("cd " + _cMakeCacheDir + "/builds/compile/" + buildName);
             buildFile.write("cmake");
             if (target == "default")
                 buildFile.write(" -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++");
             else
                 buildFile.write(" -DCMAKE_C_COMPILER=$CC -DCMAKE_CXX_COMPILER=$CXX");
-            buildFile.writeLine(" -DCMAKE_BUILD_TYPE=Release " + _cMakeCacheDir);
+            if (_ltoModes.find(target) != _ltoModes.end())
+                buildFile.write(" -DHIGGS_LTO=" + _ltoModes[target]);
+            if ((target == "default") && std::ifstream(getOptimizationProfilePath()).good())
+                buildFile.write(" -DHIGGS_PGO_PROFILE=" + getOptimizationProfilePath());
+            if (timeTrace)
+                buildFile.write(" -DHIGGS_TIME_TRACE=ON");
+            buildFile.write(getFlagsDefinitions(compileFlags, linkFlags));
+            buildFile.writeLine(" -DCMAKE_BUILD_TYPE=" + buildType + " " + _cMakeCacheDir);
             buildFile.writeLine("");
 
             // Close the build file
@@ -276,7 +516,7 @@ bool CMakeSettings::buildCMakeProject(const std::string& target)
 
         // Write-out the make command file
         bool wroteMake = false;
-        auto makeShellFile = FileWriter(_cMakeCacheDir + "/builds/compile-" + target + ".make.sh");
+        auto makeShellFile = FileWriter(_cMakeCacheDir + "/builds/compile-" + buildName + ".make.sh");
         if (makeShellFile.isOpen())
         {
 
@@ -293,7 +533,7 @@ bool CMakeSettings::buildCMakeProject(const std::string& target)
 
             // Write-in the actual Make command
             makeShellFile.writeLine("# Run the Make Operation: Compile Target " + target);
-            makeShellFile.writeLine("cd " + _cMakeCacheDir + "/builds/compile/" + target + " && make " + _projectName);
+            makeShellFile.writeLine("cd " + _cMakeCacheDir + "/builds/compile/" + buildName + " && make -j$(nproc) " + _projectName);
             makeShellFile.writeLine("");
 
             // Write-in the post-build commands
@@ -316,10 +556,10 @@ bool CMakeSettings::buildCMakeProject(const std::string& target)
             // Run the build workflow and keep track of the results
             retFlag = (HiggsBoson::RunTypeSingleton::executeInContainer(
                     "Setting-Up Build for " + _projectName + " Version " + _projectVersion,
-                    "bash " + _cMakeCacheDir + "/builds/compile-" + target + ".sh"));
+                    "bash " + _cMakeCacheDir + "/builds/compile-" + buildName + ".sh"));
             std::cout << "Building " + _projectName + " Version " + _projectVersion << std::endl;
             retFlag = (retFlag && HiggsBoson::RunTypeSingleton::executeInContainer(
-                    "bash " + _cMakeCacheDir + "/builds/compile-" + target + ".make.sh"));
+                    "bash " + _cMakeCacheDir + "/builds/compile-" + buildName + ".make.sh"));
         }
     }
 
@@ -328,74 +568,110 @@ bool CMakeSettings::buildCMakeProject(const std::string& target)
 }
 
 /**
- * Function used to compile/build the CMake project for the target
+ * Function used to profile the compile-time of the CMake project for the
+ * target, aggregating the per translation-unit time-traces into a report
+ * of the slowest translation units, headers, templates, and code generation
+ * NOTE: The report is written to "output/build-profile" and requires clang
  *
- * @param testType TestType representing CMake test to be run
- * @param testFilter String representing the test filter to apply
- * @return Boolean indicating whether the operation was successful
+ * @param target String representing the target to compile for
+ * @param budgetPath String representing the path to the time budget (if any)
+ * @return Boolean indicating whether the operation was successful (and no
+ *         translation unit exceeded its time budget)
  */
-bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testFilter)
+bool CMakeSettings::profileBuildCMakeProject(const std::string& target, const std::string& budgetPath)
 {
 
     // Create a return flag
     bool retFlag = false;
 
-    // Write-out the CMakeLists.txt file
-    auto wroteFile = writeCMakeFile(true);
-
-    // Determine the test-type string based on the provided enum
-    std::string testTypeString;
-    std::string testCMakeVarString;
-    switch (testType)
+    // Only continue if the time budget (if any) exists
+    TimeTraceProfile timeTraceProfile;
+    if (!budgetPath.empty() && !timeTraceProfile.readBudget(budgetPath))
     {
+        std::cout << "Unknown build time budget: " << budgetPath << std::endl;
+        return retFlag;
+    }
 
-        // Handle the "COVERAGE" enumeration case
-        case COVERAGE:
-            testTypeString = "coverage";
-            testCMakeVarString = "-DCODE_COVERAGE=1";
-            break;
+    // Build the project for the target with the per translation-unit time-traces
+    if (buildCMakeProject(target, "", true))
+    {
 
-        // Handle the "SANITIZE_ADDRESS" enumeration case
-        case SANITIZE_ADDRESS:
-            testTypeString = "address";
-            testCMakeVarString = "-DSANITIZE_ADDRESS=1";
-            break;
+        // Read-in each of the translation unit time-traces (written next to their objects)
+        // NOTE: The translation unit is named by its path within the objects directory
+        unsigned int traceCount = 0;
+        std::string traceSuffix = ".json";
+        for (const auto& traceFile : Utils::listFilesInDirectory(_cMakeCacheDir + "/builds/compile/" + target))
+        {
+            auto cMakeFilesPos = traceFile.find("/CMakeFiles/");
+            auto objectsDirPos = traceFile.find(".dir/", cMakeFilesPos);
+            if ((cMakeFilesPos == std::string::npos) || (objectsDirPos == std::string::npos) || (traceFile.size() <= traceSuffix.size())
+                    || (traceFile.compare(traceFile.size() - traceSuffix.size(), traceSuffix.size(), traceSuffix) != 0))
+                continue;
+            auto unitName = traceFile.substr(objectsDirPos + 5, traceFile.size() - objectsDirPos - 5 - traceSuffix.size());
+            if (timeTraceProfile.readTimeTrace(traceFile, unitName))
+                traceCount++;
+        }
 
-        // Handle the "SANITIZE_BEHAVIOR" enumeration case
-        case SANITIZE_BEHAVIOR:
-            testTypeString = "behavior";
-            testCMakeVarString = "-DSANITIZE_BEHAVIOR=1";
-            break;
+        // Write-out the report and check the translation units against the time budget
+        std::string reportDir = _cMakeBuildDir + "/output/build-profile";
+        if (traceCount == 0)
+            std::cout << "No compile-time traces were found for " << target << " (requires clang 9 or newer)" << std::endl;
+        else if (HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + reportDir)
+                && timeTraceProfile.writeReport(reportDir + "/" + target + ".txt"))
+        {
+            std::cout << "Build profile of " << traceCount << " translation units written to "
+                    << reportDir << "/" << target << ".txt" << std::endl;
+            auto budgetViolations = timeTraceProfile.getBudgetViolations();
+            for (const auto& budgetViolation : budgetViolations)
+                std::cout << "Build time budget exceeded: " << budgetViolation << std::endl;
+            retFlag = budgetViolations.empty();
+        }
+    }
 
-        // Handle the "SANITIZE_THREAD" enumeration case
-        case SANITIZE_THREAD:
-            testTypeString = "thread";
-            testCMakeVarString = "-DSANITIZE_THREAD=1";
-            break;
+    // Return the return flag
+    return retFlag;
+}
 
-        // Handle the "SANITIZE_LEAK" enumeration case
-        case SANITIZE_LEAK:
-            testTypeString = "leak";
-            testCMakeVarString = "-DSANITIZE_LEAK=1";
-            break;
+/**
+ * Function used to compile/build the CMake project for the target
+ *
+ * @param testType TestType representing CMake test to be run
+ * @param testFilter String representing the test filter to apply
+ * @param parallelJobs Unsigned Integer representing the number of test
+ *                     processes to run concurrently (test/sanitize/coverage only)
+ * @param coverageBaseRef String representing the git base reference to limit the
+ *                        coverage report to the changed files (if any)
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testFilter,
+        unsigned int parallelJobs, const std::string& coverageBaseRef)
+{
 
-        // Handle the "PROFILE" enumeration case
-        case PROFILE:
-            testTypeString = "profile";
-            break;
+    // Create a return flag
+    bool retFlag = false;
 
-        // Handle the default case
-        default:
-            testTypeString = "test";
+    // Only continue if the coverage base reference (if any) resolves to a commit
+    // NOTE: This is checked up-front so a typo does not cost a full coverage run
+    if (!coverageBaseRef.empty() && !Utils::isGitCommit(_cMakeBuildDir, coverageBaseRef))
+    {
+        std::cout << "Unknown git base reference: " << coverageBaseRef << " (it must be a fetched commit)" << std::endl;
+        return retFlag;
     }
 
-    // Force a re-build by deleting the build directory itself
-    // NOTE: This is a current workaround and should be removed
-    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " +  _cMakeCacheDir + "/builds/" + testTypeString);
+    // Write-out the CMakeLists.txt file
+    auto wroteFile = writeCMakeFile(true);
+
+    // Determine the test-type string and CMake variable based on the provided enum
+    auto testTypeSettings = getTestTypeSettings(testType);
+    std::string testTypeString = testTypeSettings.first;
+    std::string testCMakeVarString = testTypeSettings.second;
+
+    // Determine the persistent build tree for the test-type
+    // NOTE: The test, debug, and profile operations share identical flags and a build tree
+    std::string testBuildDir = _cMakeCacheDir + "/builds/" + (testCMakeVarString.empty() ? "test" : testTypeString);
 
     // Create the build directory for CMake to actually use
-    if (wroteFile && HiggsBoson::RunTypeSingleton::executeInContainer(
-        "mkdir -p " + _cMakeCacheDir + "/builds/" + testTypeString))
+    if (wroteFile && HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + testBuildDir))
     {
 
         // Write the build workflow for the specified target
@@ -412,12 +688,13 @@ bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testF
 
             // Write-in the standard build file information for the target
             buildFile.writeLine("# Build Steps for the Test operation " + testTypeString);
-            buildFile.writeLine("mkdir -p " + _cMakeCacheDir + "/builds/" + testTypeString);
-            buildFile.writeLine("cd " + _cMakeCacheDir + "/builds/" + testTypeString);
-            buildFile.write("cmake -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++");
+            buildFile.writeLine("mkdir -p " + testBuildDir);
+            buildFile.writeLine("cd " + testBuildDir);
+            std::string configureCommand = "cmake -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++";
             if (testType == TestType::COVERAGE)
-                buildFile.write(" -DCODE_COVERAGE=ON ");
-            buildFile.writeLine(" -DCMAKE_BUILD_TYPE=Debug " + _cMakeCacheDir + " " + testCMakeVarString);
+                configureCommand += " -DCODE_COVERAGE=ON ";
+            configureCommand += " -DCMAKE_BUILD_TYPE=Debug -DCATCH_TESTING=ON " + _cMakeCacheDir + " " + testCMakeVarString;
+            buildFile.writeLine(getConfigureStep(configureCommand));
             buildFile.writeLine("");
 
             // Close the build file
@@ -434,12 +711,28 @@ bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testF
             // Setup the LD_LIBRARY_PATH variable for running the tests
             std::string libraryLdPathString = "LD_LIBRARY_PATH=\"" + _cMakeBuildDir + "/output/default/deps\"";
 
-            // Setup the make command for running the test
-            std::string makeCommand = "cd " + _cMakeCacheDir + "/builds/" + testTypeString;
+            // Setup the environment for running the tests
+            // NOTE: Coverage runs write a profile per process (%p) and binary (%m) to merge afterwards
+            std::string testEnvString = libraryLdPathString;
             if (testType == TestType::COVERAGE)
-                makeCommand += " && " + libraryLdPathString + " make " + _projectName + "_test_coverage";
-            else
-                makeCommand += " && " + libraryLdPathString + " make " + _projectName + "_test";
+                testEnvString += " LLVM_PROFILE_FILE=" + testBuildDir + "/profraw/" + _projectName + "_test-%p-%m.profraw";
+
+            // Determine whether the tests should be split across parallel processes
+            bool runInParallel = ((parallelJobs > 1) && (testType != TestType::DEBUG)
+                    && (testType != TestType::PROFILE));
+
+            // Setup the make command for running the test
+            std::string makeCommand = "cd " + testBuildDir;
+            makeCommand += " && " + libraryLdPathString + " make -j$(nproc) " + _projectName + "_test";
+
+            // Setup the test command (parallel runs are sharded after the build instead)
+            std::string testCommand;
+            if ((testType != TestType::DEBUG) && (testType != TestType::PROFILE))
+                testCommand = testEnvString + " " + testBuildDir + "/bin/" + _projectName + "_test " + testFilter;
+            else if (testType == TestType::DEBUG)
+                testCommand = libraryLdPathString + " gdb " + testBuildDir + "/bin/" + _projectName + "_test";
+            else if (testType == TestType::PROFILE)
+                testCommand = libraryLdPathString + " valgrind --tool=callgrind --separate-threads=yes " + testBuildDir + "/bin/" + _projectName + "_test " + testFilter;
 
             // Write-out the make command file
             bool wroteMake = false;
@@ -448,8 +741,10 @@ bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testF
             {
 
                 // Write-in the standard Higgs-Boson header for the Make Shell file
+                // NOTE: A failed build must never fall through to running stale tests
                 makeShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
                 makeShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+                makeShellFile.writeLine("set -e");
                 makeShellFile.writeLine("");
 
                 // Write-in the pre-test commands
@@ -458,23 +753,41 @@ bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testF
                     makeShellFile.writeLine(preTestCmd);
                 makeShellFile.writeLine("");
 
-                // Write-in the actual Make command
+                // Write-in the actual Make command (keeping the test status for the post-test commands)
+                // NOTE: Coverage builds mark a successful build so only its tests are reported on
                 makeShellFile.writeLine("# Run the Make Operation: " + testTypeString);
+                if (testType == TestType::COVERAGE)
+                    makeShellFile.writeLine("rm -f " + testBuildDir + ".build.status");
                 makeShellFile.writeLine(makeCommand);
-                if ((testType != TestType::COVERAGE) && (testType != TestType::DEBUG) && (testType != TestType::PROFILE))
-                    makeShellFile.writeLine(libraryLdPathString + " " + _cMakeCacheDir + "/builds/" + testTypeString + "/bin/" + _projectName + "_test " + testFilter);
-                else if (testType == TestType::DEBUG)
-                    makeShellFile.writeLine(libraryLdPathString + " gdb " + _cMakeCacheDir + "/builds/" + testTypeString + "/bin/" + _projectName + "_test");
-                else if (testType == TestType::PROFILE)
-                    makeShellFile.writeLine(libraryLdPathString + " valgrind --tool=callgrind --separate-threads=yes " + _cMakeCacheDir + "/builds/" + testTypeString + "/bin/" + _projectName + "_test " + testFilter);
+                if (testType == TestType::COVERAGE)
+                {
+                    makeShellFile.writeLine("rm -rf " + testBuildDir + "/profraw");
+                    makeShellFile.writeLine("echo PASS > " + testBuildDir + ".build.status");
+                }
+                if (runInParallel)
+                    makeShellFile.writeLine("# NOTE: Tests are run in parallel shards after the build");
+                else
+                {
+                    makeShellFile.writeLine("HIGGS_TEST_STATUS=0");
+                    makeShellFile.writeLine(testCommand + " || HIGGS_TEST_STATUS=$?");
+                }
                 makeShellFile.writeLine("");
 
-                // Write-in the post-test commands
+                // Write-in the post-test commands (parallel runs handle them afterwards)
                 makeShellFile.writeLine("# Post-Test commands for the Test");
-                for (const auto& postTestCmd : _postTestCommands)
-                    makeShellFile.writeLine(postTestCmd);
+                if (!runInParallel)
+                    for (const auto& postTestCmd : _postTestCommands)
+                        makeShellFile.writeLine(postTestCmd);
                 makeShellFile.writeLine("");
 
+                // Write-in the test status as the overall result (if applicable)
+                if (!runInParallel)
+                {
+                    makeShellFile.writeLine("# Report the status of the Test");
+                    makeShellFile.writeLine("exit $HIGGS_TEST_STATUS");
+                    makeShellFile.writeLine("");
+                }
+
                 // Close the shell-file
                 makeShellFile.close();
 
@@ -490,10 +803,23 @@ bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testF
                 retFlag = (HiggsBoson::RunTypeSingleton::executeInContainer(
                         "Setting-Up Test " + testTypeString + " for " + _projectName + " Version " + _projectVersion,
                         "bash " + _cMakeCacheDir + "/builds/" + testTypeString + ".sh"));
+                bool setupTests = retFlag;
                 std::cout << "Running " + _projectName + " Version " + _projectVersion;
                 std::cout << " for Test " + testTypeString << std::endl;
                 retFlag = (retFlag && HiggsBoson::RunTypeSingleton::executeInContainer(
                         "bash " + _cMakeCacheDir + "/builds/" + testTypeString + ".make.sh"));
+
+                // Run the built tests across the parallel shards (if applicable)
+                if (retFlag && runInParallel)
+                    retFlag = runTestsInParallel(testTypeString, testFilter, parallelJobs, testEnvString);
+
+                // Merge the coverage profiles and report on them (if applicable)
+                // NOTE: Failed setups/builds have no profiles so their failure is returned as-is
+                std::string buildStatus;
+                if (setupTests && (testType == TestType::COVERAGE))
+                    std::ifstream(testBuildDir + ".build.status") >> buildStatus;
+                if (buildStatus == "PASS")
+                    retFlag = (reportCoverage(testBuildDir, coverageBaseRef) && retFlag);
             }
         }
     }
@@ -503,487 +829,2965 @@ bool CMakeSettings::testCMakeProject(TestType testType, const std::string& testF
 }
 
 /**
- * Internal function used to write the CMake file to the pre-defined location
+ * Function used to build and run the CMake project's tests for several
+ * test-types (test or sanitizers) concurrently, printing a result matrix
+ * NOTE: The build jobs are split evenly between the test-types' build trees
  *
- * @param isTesting Boolean indicating whether to write-out a test or not
- * @return Boolean indicating if the operation was successful or not
+ * @param testTypes Vector of TestTypes representing the CMake tests to be run
+ * @param testFilter String representing the test filter to apply
+ * @return Boolean indicating whether all builds and tests were successful
  */
-bool CMakeSettings::writeCMakeFile(bool isTesting)
+bool CMakeSettings::testCMakeProjectMatrix(const std::vector<TestType>& testTypes,
+        const std::string& testFilter)
 {
 
     // Create a return flag
     bool retFlag = false;
 
-    // Setup the main source file based on if this is a test or not
-    std::string mainSourceFile;
-    if (!isTesting)
-        mainSourceFile = _mainFile;
-
-    // Open the sanitize-blacklist file
-    bool wroteSanitize = false;
-    auto sanitizeFile = FileWriter(_cMakeCacheDir + "/sanitize-blacklist.txt");
-    if (sanitizeFile.isOpen())
+    // Only the plain test and sanitizer test-types can be run unattended together
+    for (auto testType : testTypes)
     {
+        if ((testType == TestType::COVERAGE) || (testType == TestType::DEBUG) || (testType == TestType::PROFILE))
+        {
+            std::cout << "Only test and sanitizer test-types can be run as a matrix" << std::endl;
+            return retFlag;
+        }
+    }
 
-        // Write-in the standard Higgs-Boson header for the sanitize-blacklist file
-        sanitizeFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
-        sanitizeFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
-        sanitizeFile.writeLine("");
-
-        // Write-in the standard sanitize-blacklist file information
-        sanitizeFile.writeLine("# Add external paths as black-list");
-        sanitizeFile.writeLine("src:*/external/output/*");
-        sanitizeFile.writeLine("src:*/external/catch2/*");
-        sanitizeFile.writeLine("src:*/lib/*");
-        sanitizeFile.writeLine("src:*/lib64/*");
-        sanitizeFile.writeLine("src:*/bin/*");
-
-        // Close the sanitize-blacklist file
-        sanitizeFile.close();
+    // Write-out the CMakeLists.txt file
+    auto wroteFile = writeCMakeFile(true);
 
-        // If we get here, mark the operation as successful
-        wroteSanitize = true;
-    }
+    // Setup the LD_LIBRARY_PATH variable for running the tests
+    std::string libraryLdPathString = "LD_LIBRARY_PATH=\"" + _cMakeBuildDir + "/output/default/deps\"";
 
-    // Open the Catch2 Main Testing file
-    bool wroteCatch2 = false;
-    auto catch2File = FileWriter(_cMakeCacheDir + "/main.test.cpp");
-    if (catch2File.isOpen())
+    // Write-out the matrix shell file building and running all test-types concurrently
+    bool wroteMatrix = false;
+    std::string buildsDir = _cMakeCacheDir + "/builds";
+    HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + buildsDir);
+    auto matrixShellFile = FileWriter(buildsDir + "/matrix.sh");
+    if (wroteFile && !testTypes.empty() && matrixShellFile.isOpen())
     {
 
-        // Write-in the standard Higgs-Boson header for the Catch2 Main Testing file
-        catch2File.writeLine("// THIS IS AN AUTOGENERATED FILE USING HIGGS");
-        catch2File.writeLine("// DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
-        catch2File.writeLine("");
+        // Write-in the standard Higgs-Boson header for the matrix file
+        // NOTE: Results are recorded per test-type rather than aborting the script
+        matrixShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        matrixShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        matrixShellFile.writeLine("");
+
+        // Write-in the pre-test commands
+        matrixShellFile.writeLine("# Pre-Test commands for the Test");
+        for (const auto& preTestCmd : _preTestCommands)
+            matrixShellFile.writeLine(preTestCmd);
+        matrixShellFile.writeLine("");
+
+        // Write-in the split of the build jobs between the build trees
+        matrixShellFile.writeLine("# Split the build jobs between the concurrent builds");
+        matrixShellFile.writeLine("jobs=$(( ($(nproc) + " + std::to_string(testTypes.size() - 1)
+                + ") / " + std::to_string(testTypes.size()) + " ))");
+        matrixShellFile.writeLine("");
+
+        // Write-in the concurrent configure and build of each test-type's build tree
+        for (auto testType : testTypes)
+        {
+            auto testTypeSettings = getTestTypeSettings(testType);
+            std::string testBuildDir = buildsDir + "/" + testTypeSettings.first;
+            std::string configureCommand = "cmake -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++";
+            configureCommand += " -DCMAKE_BUILD_TYPE=Debug -DCATCH_TESTING=ON " + _cMakeCacheDir + " " + testTypeSettings.second;
+            matrixShellFile.writeLine("# Configure and build the " + testTypeSettings.first + " build tree (in the background)");
+            matrixShellFile.writeLine("rm -f " + testBuildDir + ".build.status " + testBuildDir + ".run.status");
+            matrixShellFile.writeLine("(");
+            matrixShellFile.writeLine("    set -e");
+            matrixShellFile.writeLine("    mkdir -p " + testBuildDir);
+            matrixShellFile.writeLine("    cd " + testBuildDir);
+            for (const auto& configureLine : Utils::splitStringByDelimiter(getConfigureStep(configureCommand), '\n'))
+                matrixShellFile.writeLine("    " + configureLine);
+            matrixShellFile.writeLine("    " + libraryLdPathString + " make -j$jobs " + _projectName + "_test");
+            matrixShellFile.writeLine("    echo PASS > " + testBuildDir + ".build.status");
+            matrixShellFile.writeLine(") > " + testBuildDir + ".build.log 2>&1 &");
+            matrixShellFile.writeLine("");
+        }
+        matrixShellFile.writeLine("wait");
+        matrixShellFile.writeLine("");
 
-        // Write-in the standard Catch2 Main Testing file information
-        catch2File.writeLine("// Boiler-plate setup for catch2");
-        catch2File.writeLine("#define CATCH_CONFIG_MAIN");
-        catch2File.writeLine("#include <catch.hpp>");
-        catch2File.writeLine("");
+        // Write-in the concurrent runs of the successfully built tests
+        matrixShellFile.writeLine("# Run the successfully built tests concurrently");
+        for (auto testType : testTypes)
+        {
+            std::string testBuildDir = buildsDir + "/" + getTestTypeSettings(testType).first;
+            matrixShellFile.writeLine("if [ -f " + testBuildDir + ".build.status ]; then");
+            matrixShellFile.writeLine("    (" + libraryLdPathString + " " + testBuildDir + "/bin/" + _projectName + "_test "
+                    + testFilter + " > " + testBuildDir + ".run.log 2>&1 && echo PASS > " + testBuildDir
+                    + ".run.status || echo FAIL > " + testBuildDir + ".run.status) &");
+            matrixShellFile.writeLine("fi");
+        }
+        matrixShellFile.writeLine("wait");
+        matrixShellFile.writeLine("");
 
-        // Write-in the testing include files
-        for (const auto& item : _testFiles)
-            catch2File.writeLine("#include \"" + item.first + "\"");
+        // Write-in the post-test commands
+        matrixShellFile.writeLine("# Post-Test commands for the Test");
+        for (const auto& postTestCmd : _postTestCommands)
+            matrixShellFile.writeLine(postTestCmd);
+        matrixShellFile.writeLine("");
 
-        // Close the Catch2 Main Testing file
-        catch2File.close();
+        // Close the shell-file
+        matrixShellFile.close();
 
-        // If we get here, mark the operation as successful
-        wroteCatch2 = true;
+        // Indicate that the matrix shell file was written properly
+        wroteMatrix = true;
     }
 
-    // Only continue if the sanitize and Catch2 operation was successful
-    if (wroteSanitize && wroteCatch2)
+    // Only continue if the matrix file was written properly
+    if (wroteMatrix)
     {
 
-        // Open the CMake file
-        auto cMakeFile = FileWriter(_cMakeFile);
-        if (cMakeFile.isOpen())
+        // Build and run all of the test-types concurrently
+        std::cout << "Building and Running " + _projectName + " Version " + _projectVersion;
+        std::cout << " for Tests " + std::to_string(testTypes.size()) + " concurrently" << std::endl;
+        retFlag = HiggsBoson::RunTypeSingleton::executeInContainer("bash " + buildsDir + "/matrix.sh");
+
+        // Read-in and print the combined results matrix
+        std::cout << std::endl;
+        std::cout << std::left << std::setw(12) << "Test" << std::setw(8) << "Build" << "Run" << std::endl;
+        for (auto testType : testTypes)
         {
+            std::string testTypeString = getTestTypeSettings(testType).first;
+            std::string buildStatus = "FAIL";
+            std::string runStatus = "SKIP";
+            std::ifstream(buildsDir + "/" + testTypeString + ".build.status") >> buildStatus;
+            std::ifstream(buildsDir + "/" + testTypeString + ".run.status") >> runStatus;
+            std::cout << std::left << std::setw(12) << testTypeString << std::setw(8) << buildStatus << runStatus << std::endl;
+            retFlag = (retFlag && (buildStatus == "PASS") && (runStatus == "PASS"));
+        }
+        std::cout << std::endl;
+        std::cout << "Build and Run logs written to: " << buildsDir << "/<test>.build.log and <test>.run.log" << std::endl;
+    }
 
-            // Write-in the standard Higgs-Boson header for the CMake file
-            cMakeFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
-            cMakeFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
-            cMakeFile.writeLine("");
+    // Return the return flag
+    return retFlag;
+}
 
-            // Write-in the CMake minumum requirements information
-            cMakeFile.writeLine("# Setup the CMake minimum requirements");
-            cMakeFile.writeLine("cmake_minimum_required(VERSION 3.9.0)");
+/**
+ * Function used to build and run only the CMake project's tests affected by
+ * the files changed against the given git base reference
+ * NOTE: The affected tests are those whose test files (transitively) include a changed file
+ *
+ * @param baseRef String representing the git base reference (ie. "origin/main")
+ * @param parallelJobs Unsigned Integer representing the number of test processes to run concurrently
+ * @return Boolean indicating whether the operation (and all affected tests) were successful
+ */
+bool CMakeSettings::testCMakeProjectAffected(const std::string& baseRef, unsigned int parallelJobs)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Determine the test-cases affected by the changes (failing for unknown base references)
+    std::vector<std::string> affectedTestNames;
+    if (!getAffectedTestNames(baseRef, affectedTestNames))
+    {
+        std::cout << "Unknown git base reference: " << baseRef << " (it must be a fetched commit)" << std::endl;
+        return retFlag;
+    }
+    if (affectedTestNames.empty())
+    {
+        std::cout << "No tests are affected by the changes against " << baseRef << std::endl;
+        return true;
+    }
+
+    // Write-out the affected test-cases as a test-specification (input) file
+    std::string specFilePath = _cMakeCacheDir + "/builds/affected.txt";
+    HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + _cMakeCacheDir + "/builds");
+
+    // Run the affected test-cases (only)
+    if (writeTestSpecFile(specFilePath, affectedTestNames))
+    {
+        std::cout << "Running " << affectedTestNames.size() << " test-case(s) affected by the changes against "
+                << baseRef << std::endl;
+        retFlag = testCMakeProject(TestType::TEST, "-f " + specFilePath, parallelJobs);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to build (release) and run the CMake project's benchmarks
+ * NOTE: The results are written to "output/bench" as JSON and TSV
+ *
+ * @param benchFilter String representing the benchmark filter to apply
+ * @param saveBaseline String representing the baseline to save the results as (if any)
+ * @param compareBaseline String representing the baseline to compare against (if any)
+ * @param recordCounters Boolean indicating whether to record the hardware counters
+ *                       (persisted with the commit hash to ".higgs-boson/metrics")
+ * @return Boolean indicating whether the operation was successful (and no
+ *         benchmark regressed against the compared baseline)
+ */
+bool CMakeSettings::benchCMakeProject(const std::string& benchFilter,
+        const std::string& saveBaseline, const std::string& compareBaseline, bool recordCounters)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the baseline to compare against exists
+    if (!compareBaseline.empty() && !std::ifstream(_cMakeCacheDir + "/bench/" + compareBaseline + ".json").good())
+    {
+        std::cout << "Unknown benchmark baseline: " << compareBaseline << std::endl;
+        return retFlag;
+    }
+
+    // Write-out the CMakeLists.txt file
+    auto wroteFile = writeCMakeFile(false);
+
+    // Define the benchmark build and results directories
+    std::string benchBuildDir = _cMakeCacheDir + "/builds/bench";
+    std::string benchOutputDir = _cMakeBuildDir + "/output/bench";
+
+    // Force a re-build by deleting the build directory itself
+    // NOTE: This is a current workaround and should be removed
+    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + benchBuildDir);
+
+    // Create the build directory for CMake to actually use
+    if (wroteFile && HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + benchBuildDir))
+    {
+
+        // Write the build workflow for the benchmarks
+        // NOTE: Benchmarks are built like a release of the default target, using
+        //       the "release" build profile, link-time optimization, and PGO profile
+        bool wroteBuildFile = false;
+        auto buildFile = FileWriter(_cMakeCacheDir + "/builds/bench.sh");
+        if (buildFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the build file
+            buildFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            buildFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            buildFile.writeLine("set -e");
+            buildFile.writeLine("");
+
+            // Write-in the standard build file information for the benchmarks
+            buildFile.writeLine("# Build Steps for the Benchmark operation");
+            buildFile.writeLine("mkdir -p " + benchBuildDir);
+            buildFile.writeLine("cd " + benchBuildDir);
+            buildFile.write("cmake -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++");
+            if (_ltoModes.find("default") != _ltoModes.end())
+                buildFile.write(" -DHIGGS_LTO=" + _ltoModes["default"]);
+            if (std::ifstream(getOptimizationProfilePath()).good())
+                buildFile.write(" -DHIGGS_PGO_PROFILE=" + getOptimizationProfilePath());
+            std::string buildType = "Release";
+            if (_profileBuildTypes["release"].find("default") != _profileBuildTypes["release"].end())
+            {
+                buildType = _profileBuildTypes["release"]["default"];
+                buildFile.write(getFlagsDefinitions(_profileCompileFlags["release"]["default"],
+                        _profileLinkFlags["release"]["default"]));
+            }
+            buildFile.writeLine(" -DCMAKE_BUILD_TYPE=" + buildType + " " + _cMakeCacheDir);
+            buildFile.writeLine("");
+
+            // Close the build file
+            buildFile.close();
+
+            // If we get here, mark the operation as successful
+            wroteBuildFile = true;
+        }
+
+        // Write-out the make (and run) command file
+        bool wroteMake = false;
+        auto makeShellFile = FileWriter(_cMakeCacheDir + "/builds/bench.make.sh");
+        if (makeShellFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the Make Shell file
+            makeShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            makeShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            makeShellFile.writeLine("set -e");
+            makeShellFile.writeLine("");
+
+            // Write-in the actual Make command
+            makeShellFile.writeLine("# Run the Make Operation: bench");
+            makeShellFile.writeLine("cd " + benchBuildDir + " && make -j$(nproc) " + _projectName + "_bench");
+            makeShellFile.writeLine("");
+
+            // Write-in the (non-root) hardware counter access for the builder container (if applicable)
+            if (recordCounters)
+            {
+                makeShellFile.writeLine("# Allow perf to count the (non-root) benchmarks in the builder container");
+                makeShellFile.writeLine(getPerfAccessStep("2"));
+                makeShellFile.writeLine("");
+            }
+
+            // Write-in the benchmark run with the machine-readable results (and hardware counters)
+            makeShellFile.writeLine("# Run the benchmarks and write-out the results");
+            makeShellFile.writeLine("mkdir -p " + benchOutputDir);
+            makeShellFile.writeLine("LD_LIBRARY_PATH=\"" + _cMakeBuildDir + "/output/default/deps\" "
+                    + (recordCounters ? ("perf stat -x, -o " + benchOutputDir + "/counters.csv -e "
+                    + PerfCounters::getEvents() + " -- ") : std::string())
+                    + benchBuildDir + "/bin/" + _projectName + "_bench '" + benchFilter + "'"
+                    + " --json " + benchOutputDir + "/results.json --tsv " + benchOutputDir + "/results.tsv");
+            makeShellFile.writeLine("");
+
+            // Close the shell-file
+            makeShellFile.close();
+
+            // Indicate that the Make Shell file was written properly
+            wroteMake = true;
+        }
+
+        // Only continue if the build files were written successfully
+        if (wroteBuildFile && wroteMake)
+        {
+
+            // Run the build workflow and keep track of the results
+            retFlag = (HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "Setting-Up Benchmarks for " + _projectName + " Version " + _projectVersion,
+                    "bash " + _cMakeCacheDir + "/builds/bench.sh"));
+            std::cout << "Running Benchmarks for " + _projectName + " Version " + _projectVersion << std::endl;
+            retFlag = (retFlag && HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "bash " + _cMakeCacheDir + "/builds/bench.make.sh"));
+
+            // Report the location of the results
+            if (retFlag)
+                std::cout << "Benchmark results written to " << benchOutputDir << "/results.json" << std::endl;
+
+            // Report and persist the hardware counters with the commit hash (if requested)
+            if (retFlag && recordCounters)
+            {
+                PerfCounters perfCounters;
+                std::string metricsPath = _cMakeCacheDir + "/metrics/bench.tsv";
+                retFlag = (perfCounters.readPerfStat(benchOutputDir + "/counters.csv")
+                        && HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + _cMakeCacheDir + "/metrics")
+                        && perfCounters.appendMetrics(metricsPath, Utils::getSourceRevision(_cMakeBuildDir)));
+                std::cout << perfCounters.getSummary();
+                if (retFlag)
+                    std::cout << "Hardware counters appended to " << metricsPath << std::endl;
+            }
+
+            // Compare the results against the baseline (if requested)
+            if (retFlag && !compareBaseline.empty())
+                retFlag = compareBenchmarkResults(benchOutputDir + "/results.json", compareBaseline);
+
+            // Save the results as the baseline (if requested)
+            // NOTE: Regressed results are never saved over a baseline
+            if (retFlag && !saveBaseline.empty())
+            {
+                std::string baselinePath = _cMakeCacheDir + "/bench/" + saveBaseline + ".json";
+                retFlag = HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + _cMakeCacheDir
+                        + "/bench && cp " + benchOutputDir + "/results.json " + baselinePath);
+                if (retFlag)
+                    std::cout << "Benchmark baseline \"" << saveBaseline << "\" saved to " << baselinePath << std::endl;
+            }
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to generate the profile-guided optimization profile by
+ * building an instrumented project, running the training workload, and
+ * merging the results into the (source-hash keyed) profile cache
+ * NOTE: Only the default target is supported since the workload is run
+ *       in the builder container
+ *
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CMakeSettings::generateOptimizationProfile()
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Write-out the CMakeLists.txt file (including the tests for test workloads)
+    bool isTestWorkload = (_pgoWorkloadType == "test");
+    bool isBenchWorkload = (_pgoWorkloadType == "bench");
+    auto wroteFile = writeCMakeFile(isTestWorkload);
+
+    // Define the instrumented build directory and profile locations
+    std::string pgoBuildDir = _cMakeCacheDir + "/builds/pgo";
+    std::string pgoRawDir = pgoBuildDir + "/profiles";
+    std::string profilePath = getOptimizationProfilePath();
+
+    // Force a re-build by deleting the build directory itself
+    // NOTE: This is a current workaround and should be removed
+    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + pgoBuildDir);
+
+    // Create the build directory for CMake to actually use
+    if (wroteFile && HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + pgoBuildDir))
+    {
+
+        // Write the instrumented build workflow
+        bool wroteBuildFile = false;
+        auto buildFile = FileWriter(_cMakeCacheDir + "/builds/pgo.sh");
+        if (buildFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the build file
+            buildFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            buildFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            buildFile.writeLine("set -e");
+            buildFile.writeLine("");
+
+            // Write-in the standard build file information for the instrumented build
+            buildFile.writeLine("# Build Steps for the instrumented Profile-Guided Optimization operation");
+            buildFile.writeLine("mkdir -p " + pgoBuildDir);
+            buildFile.writeLine("cd " + pgoBuildDir);
+            buildFile.write("cmake -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++");
+            buildFile.write(" -DHIGGS_PGO_GENERATE=ON");
+            if (isTestWorkload)
+                buildFile.write(" -DCATCH_TESTING=ON");
+            buildFile.writeLine(" -DCMAKE_BUILD_TYPE=Release " + _cMakeCacheDir);
+            buildFile.writeLine("");
+
+            // Close the build file
+            buildFile.close();
+
+            // If we get here, mark the operation as successful
+            wroteBuildFile = true;
+        }
+
+        // Write the training workflow (build, run the workload, and merge the profiles)
+        bool wroteTrainFile = false;
+        auto trainFile = FileWriter(_cMakeCacheDir + "/builds/pgo.train.sh");
+        if (trainFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the training file
+            trainFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            trainFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            trainFile.writeLine("set -e");
+            trainFile.writeLine("");
+
+            // Write-in the tool availability check
+            trainFile.writeLine("# Ensure the profile merging tool is available");
+            trainFile.writeLine("if ! command -v llvm-profdata > /dev/null 2>&1; then");
+            trainFile.writeLine("    echo \"llvm-profdata was not found in the builder container\"");
+            trainFile.writeLine("    exit 1");
+            trainFile.writeLine("fi");
+            trainFile.writeLine("");
+
+            // Write-in the instrumented build
+            trainFile.writeLine("# Build the instrumented project");
+            trainFile.writeLine("cd " + pgoBuildDir + " && make -j$(nproc) " + _projectName
+                    + (isTestWorkload ? "_test" : (isBenchWorkload ? "_bench" : "")));
+            trainFile.writeLine("");
+
+            // Write-in the training workload with each process writing its own raw profile
+            trainFile.writeLine("# Run the training workload: " + _pgoWorkloadType);
+            trainFile.writeLine("rm -rf " + pgoRawDir);
+            trainFile.writeLine("mkdir -p " + pgoRawDir);
+            trainFile.writeLine("export LLVM_PROFILE_FILE=\"" + pgoRawDir + "/%p-%m.profraw\"");
+            trainFile.writeLine("export LD_LIBRARY_PATH=\"" + _cMakeBuildDir + "/output/default/deps:"
+                    + pgoBuildDir + "/lib:$LD_LIBRARY_PATH\"");
+            if (isTestWorkload)
+            {
+                trainFile.writeLine(pgoBuildDir + "/bin/" + _projectName + "_test " + _pgoWorkload);
+            }
+            else if (isBenchWorkload)
+            {
+                trainFile.writeLine(pgoBuildDir + "/bin/" + _projectName + "_bench '" + _pgoWorkload + "'");
+            }
+            else
+            {
+                trainFile.writeLine("export PATH=\"" + pgoBuildDir + "/bin:$PATH\"");
+                trainFile.writeLine("cd " + _cMakeBuildDir + " && " + _pgoWorkload);
+            }
+            trainFile.writeLine("");
+
+            // Write-in the merge of the raw profiles into the profile cache
+            trainFile.writeLine("# Merge the raw profiles into the cached profile");
+            trainFile.writeLine("if ! ls " + pgoRawDir + "/*.profraw > /dev/null 2>&1; then");
+            trainFile.writeLine("    echo \"The training workload did not produce any profiles\"");
+            trainFile.writeLine("    exit 1");
+            trainFile.writeLine("fi");
+            trainFile.writeLine("mkdir -p " + _cMakeCacheDir + "/pgo");
+            trainFile.writeLine("llvm-profdata merge -output=" + profilePath + ".tmp " + pgoRawDir + "/*.profraw");
+            trainFile.writeLine("mv -f " + profilePath + ".tmp " + profilePath);
+            trainFile.writeLine("");
+
+            // Close the training file
+            trainFile.close();
+
+            // If we get here, mark the operation as successful
+            wroteTrainFile = true;
+        }
+
+        // Only continue if the build files were written successfully
+        if (wroteBuildFile && wroteTrainFile)
+        {
+
+            // Run the instrumented build and training workflows and keep track of the results
+            retFlag = (HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "Setting-Up Instrumented Build for " + _projectName + " Version " + _projectVersion,
+                    "bash " + _cMakeCacheDir + "/builds/pgo.sh"));
+            std::cout << "Training " + _projectName + " Version " + _projectVersion;
+            std::cout << " for Profile-Guided Optimization" << std::endl;
+            retFlag = (retFlag && HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "bash " + _cMakeCacheDir + "/builds/pgo.train.sh"));
+
+            // Report the location of the generated profile
+            if (retFlag)
+                std::cout << "Optimization profile written to " << profilePath << std::endl;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to profile the CMake project by building an optimized
+ * (frame-pointer enabled) project and running the workload under the
+ * profiler, writing the reports and flame graph to "output/profile"
+ * NOTE: Only the default target is supported since the workload is run
+ *       in the builder container
+ *
+ * @param profileType ProfileType representing the profiler to run
+ * @param workloadType String representing the workload type (run, test, or bench)
+ * @param workload String representing the command to run (run) or the
+ *                 test/benchmark filter to apply (test/bench)
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CMakeSettings::profileCMakeProject(ProfileType profileType,
+        const std::string& workloadType, const std::string& workload)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the workload type is supported
+    bool isTestWorkload = (workloadType == "test");
+    bool isBenchWorkload = (workloadType == "bench");
+    if (!isTestWorkload && !isBenchWorkload && (workloadType != "run"))
+    {
+        std::cout << "Unknown profiling workload: " << workloadType << std::endl;
+        return retFlag;
+    }
+
+    // Determine the profile-type string (and settings) based on the provided enum
+    std::string profileTypeString;
+    std::string profileTitle;
+    std::string perfEventParanoid;
+    switch (profileType)
+    {
+
+        // Handle the "OFF_CPU" enumeration case
+        // NOTE: Tracepoints require the least restrictive perf event access
+        case OFF_CPU:
+            profileTypeString = "offcpu";
+            profileTitle = "Off-CPU (blocked time)";
+            perfEventParanoid = "-1";
+            break;
+
+        // Handle the "HEAP" enumeration case
+        // NOTE: Heap profiling is done by heaptrack so perf is not used at all
+        case HEAP:
+            profileTypeString = "heap";
+            profileTitle = "Heap (allocations)";
+            break;
+
+        // Handle the "CACHE" enumeration case
+        // NOTE: Cache simulation is done by cachegrind (perf c2c is best-effort)
+        case CACHE:
+            profileTypeString = "cache";
+            profileTitle = "Cache (cachegrind)";
+            break;
+
+        // Handle the default ("SAMPLER") case
+        default:
+            profileTypeString = "perf";
+            profileTitle = "CPU (perf)";
+            perfEventParanoid = "1";
+    }
+
+    // Write-out the CMakeLists.txt file (including the tests for test workloads)
+    auto wroteFile = writeCMakeFile(isTestWorkload);
+
+    // Define the profiling build, output, and tooling locations
+    std::string profileBuildDir = _cMakeCacheDir + "/builds/profile-" + profileTypeString;
+    std::string profileOutputDir = _cMakeBuildDir + "/output/profile";
+    std::string profileOutput = profileOutputDir + "/" + profileTypeString;
+
+    // Define the workload command (quoting run commands for the profiler's shell)
+    // NOTE: Heap profiling only follows a single process so run commands are used as-is
+    std::string workloadCommand;
+    if (isTestWorkload)
+        workloadCommand = profileBuildDir + "/bin/" + _projectName + "_test " + workload;
+    else if (isBenchWorkload)
+        workloadCommand = profileBuildDir + "/bin/" + _projectName + "_bench '" + workload + "'";
+    else if (profileType == ProfileType::HEAP)
+        workloadCommand = workload;
+    else
+    {
+        workloadCommand = "sh -c '";
+        for (auto character : workload)
+            workloadCommand += ((character == '\'') ? std::string("'\\''") : std::string(1, character));
+        workloadCommand += "'";
+    }
+
+    // Force a re-build by deleting the build directory itself
+    // NOTE: This is a current workaround and should be removed
+    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + profileBuildDir);
+
+    // Create the build directory for CMake to actually use
+    if (wroteFile && HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + profileBuildDir))
+    {
+
+        // Write the profiling build workflow
+        // NOTE: Profiles are taken from optimized code with frame-pointers so
+        //       the (cheap) frame-pointer stack unwinding stays accurate
+        bool wroteBuildFile = false;
+        auto buildFile = FileWriter(_cMakeCacheDir + "/builds/profile-" + profileTypeString + ".sh");
+        if (buildFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the build file
+            buildFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            buildFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            buildFile.writeLine("set -e");
+            buildFile.writeLine("");
+
+            // Write-in the standard build file information for the profiling build
+            buildFile.writeLine("# Build Steps for the Profile operation " + profileTypeString);
+            buildFile.writeLine("mkdir -p " + profileBuildDir);
+            buildFile.writeLine("cd " + profileBuildDir);
+            buildFile.write("cmake -DCMAKE_C_COMPILER=/usr/bin/clang -DCMAKE_CXX_COMPILER=/usr/bin/clang++");
+            buildFile.write(" '-DHIGGS_COMPILE_FLAGS=-fno-omit-frame-pointer;-mno-omit-leaf-frame-pointer'");
+            if (isTestWorkload)
+                buildFile.write(" -DCATCH_TESTING=ON");
+            buildFile.writeLine(" -DCMAKE_BUILD_TYPE=RelWithDebInfo " + _cMakeCacheDir);
+            buildFile.writeLine("");
+
+            // Close the build file
+            buildFile.close();
+
+            // If we get here, mark the operation as successful
+            wroteBuildFile = true;
+        }
+
+        // Write the profiling workflow (build, run the workload, and write the reports)
+        bool wroteMake = false;
+        auto makeShellFile = FileWriter(_cMakeCacheDir + "/builds/profile-" + profileTypeString + ".make.sh");
+        if (makeShellFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the Make Shell file
+            makeShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            makeShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            makeShellFile.writeLine("set -e");
+            makeShellFile.writeLine("");
+
+            // Write-in the tool availability checks (perf is checked alongside its event access)
+            if (profileType == ProfileType::HEAP)
+            {
+                makeShellFile.writeLine("# Ensure the profiling tools are available");
+                makeShellFile.writeLine("if ! command -v heaptrack > /dev/null 2>&1 || ! command -v heaptrack_print > /dev/null 2>&1; then");
+                makeShellFile.writeLine("    echo \"heaptrack was not found in the builder container (install heaptrack)\"");
+                makeShellFile.writeLine("    exit 1");
+                makeShellFile.writeLine("fi");
+            }
+            else if (profileType == ProfileType::CACHE)
+            {
+                makeShellFile.writeLine("# Ensure the profiling tools are available");
+                makeShellFile.writeLine("if ! command -v valgrind > /dev/null 2>&1 || ! command -v cg_annotate > /dev/null 2>&1; then");
+                makeShellFile.writeLine("    echo \"valgrind was not found in the builder container (install valgrind)\"");
+                makeShellFile.writeLine("    exit 1");
+                makeShellFile.writeLine("fi");
+                makeShellFile.writeLine("");
+            }
+
+            // Write-in the perf availability and (non-root) event access for the builder container (if applicable)
+            if (!perfEventParanoid.empty())
+            {
+                makeShellFile.writeLine("# Allow perf to profile the (non-root) workload in the builder container");
+                makeShellFile.writeLine(getPerfAccessStep(perfEventParanoid));
+                if (profileType == ProfileType::OFF_CPU)
+                {
+                    makeShellFile.writeLine(getKernelSettingStep("sched_schedstats", "!=", "1"));
+                    makeShellFile.writeLine("if [ \"$(cat /proc/sys/kernel/sched_schedstats 2> /dev/null)\" != \"1\" ]; then");
+                    makeShellFile.writeLine("    echo \"sched_schedstats could not be enabled (run 'sysctl kernel.sched_schedstats=1' on the docker host)\"");
+                    makeShellFile.writeLine("    exit 1");
+                    makeShellFile.writeLine("fi");
+                }
+                makeShellFile.writeLine("");
+            }
+
+            // Write-in the profiling build
+            makeShellFile.writeLine("# Build the profiling project");
+            makeShellFile.writeLine("cd " + profileBuildDir + " && make -j$(nproc) " + _projectName
+                    + (isTestWorkload ? "_test" : (isBenchWorkload ? "_bench" : "")));
+            makeShellFile.writeLine("");
+
+            // Write-in the workload run under the profiler
+            makeShellFile.writeLine("# Run the workload under the profiler: " + workloadType);
+            makeShellFile.writeLine("mkdir -p " + profileOutputDir);
+            makeShellFile.writeLine("export LD_LIBRARY_PATH=\"" + _cMakeBuildDir + "/output/default/deps:"
+                    + profileBuildDir + "/lib:$LD_LIBRARY_PATH\"");
+            makeShellFile.writeLine("export PATH=\"" + profileBuildDir + "/bin:$PATH\"");
+            makeShellFile.writeLine("cd " + _cMakeBuildDir);
+            if (profileType == ProfileType::OFF_CPU)
+            {
+                makeShellFile.writeLine("perf record -g -e sched:sched_switch -e sched:sched_stat_sleep"
+                        " -e sched:sched_stat_blocked -e syscalls:sys_enter_futex -e syscalls:sys_exit_futex"
+                        " -o " + profileOutput + ".data -- " + workloadCommand);
+                makeShellFile.writeLine("perf script --ns -F comm,tid,time,event,trace,ip,sym,dso -i "
+                        + profileOutput + ".data > " + profileOutput + ".script");
+            }
+            else if (profileType == ProfileType::HEAP)
+            {
+                makeShellFile.writeLine("rm -f " + profileOutput + ".data.*");
+                makeShellFile.writeLine("heaptrack -o " + profileOutput + ".data " + workloadCommand);
+            }
+            else if (profileType == ProfileType::CACHE)
+            {
+                makeShellFile.writeLine("rm -f " + profileOutput + ".cachegrind " + profileOutput + ".*.cachegrind " + profileOutput + ".c2c.*");
+                makeShellFile.writeLine("valgrind --tool=cachegrind --cache-sim=yes --trace-children=yes"
+                        " --cachegrind-out-file=" + profileOutput + ".%p.cachegrind " + workloadCommand);
+                makeShellFile.writeLine("");
+
+                // Write-in the (best-effort) contended cache line run as it needs hardware memory sampling
+                makeShellFile.writeLine("# Record the contended (false-shared) cache lines when perf c2c is supported");
+                makeShellFile.writeLine("if perf --version > /dev/null 2>&1; then");
+                for (const auto& settingLine : Utils::splitStringByDelimiter(
+                        getKernelSettingStep("perf_event_paranoid", "-gt", "0"), '\n'))
+                    makeShellFile.writeLine("    " + settingLine);
+                makeShellFile.writeLine("    if perf c2c record -o " + profileOutput + ".c2c.data -- "
+                        + workloadCommand + " > /dev/null 2>&1; then");
+                makeShellFile.writeLine("        perf c2c report -i " + profileOutput + ".c2c.data --stdio"
+                        " > " + profileOutput + ".c2c.txt 2> /dev/null || true");
+                makeShellFile.writeLine("    else");
+                makeShellFile.writeLine("        echo \"perf c2c is not supported here so contended cache lines were not recorded\"");
+                makeShellFile.writeLine("    fi");
+                makeShellFile.writeLine("else");
+                makeShellFile.writeLine("    echo \"perf was not found so contended cache lines were not recorded\"");
+                makeShellFile.writeLine("fi");
+            }
+            else
+                makeShellFile.writeLine("perf record -F 999 -g -o " + profileOutput + ".data -- " + workloadCommand);
+            makeShellFile.writeLine("");
+
+            // Close the shell-file
+            makeShellFile.close();
+
+            // Indicate that the Make Shell file was written properly
+            wroteMake = true;
+        }
+
+        // Write the reporting workflow (the flame graphs are written by higgs-boson itself)
+        bool wroteReport = false;
+        auto reportFile = FileWriter(_cMakeCacheDir + "/builds/profile-" + profileTypeString + ".report.sh");
+        if (reportFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the report file
+            reportFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            reportFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            reportFile.writeLine("set -e");
+            reportFile.writeLine("");
+
+            // Write-in the reports (off-CPU stacks are folded and reported by higgs-boson itself)
+            reportFile.writeLine("# Write-out the profiler reports and (sampled) stacks");
+            if (profileType == ProfileType::HEAP)
+            {
+                reportFile.writeLine("HEAP_DATA=$(ls -t " + profileOutput + ".data.* | head -n 1)");
+                reportFile.writeLine("heaptrack_print -f \"$HEAP_DATA\" --print-peaks 1 --print-allocators 1 --print-temporary 1"
+                        " --print-leaks 1 --peak-limit 20 --flamegraph-cost-type allocations --print-flamegraph "
+                        + profileOutput + ".folded --print-massif " + profileOutput + ".massif > " + profileOutput + ".txt");
+                reportFile.writeLine("if command -v ms_print > /dev/null 2>&1; then");
+                reportFile.writeLine("    ms_print " + profileOutput + ".massif > " + profileOutput + ".timeline.txt");
+                reportFile.writeLine("else");
+                reportFile.writeLine("    echo \"ms_print (valgrind) was not found so the peak-memory timeline was not written\"");
+                reportFile.writeLine("fi");
+            }
+            else if (profileType == ProfileType::CACHE)
+            {
+                reportFile.writeLine("cg_merge -o " + profileOutput + ".cachegrind " + profileOutput + ".*.cachegrind");
+                reportFile.writeLine("cg_annotate --auto=yes " + profileOutput + ".cachegrind > " + profileOutput + ".annotate.txt");
+            }
+            else if (profileType != ProfileType::OFF_CPU)
+            {
+                reportFile.writeLine("perf script -F comm,tid,time,event,ip,sym,dso -i " + profileOutput + ".data > "
+                        + profileOutput + ".script");
+                reportFile.writeLine("perf report -i " + profileOutput + ".data --stdio --no-children"
+                        " --sort symbol --percent-limit 0.5 > " + profileOutput + ".txt 2> /dev/null");
+            }
+            reportFile.writeLine("");
+
+            // Close the report file
+            reportFile.close();
+
+            // Indicate that the report file was written properly
+            wroteReport = true;
+        }
+
+        // Only continue if the build files were written successfully
+        if (wroteBuildFile && wroteMake && wroteReport)
+        {
+
+            // Run the build and profiling workflows and keep track of the results
+            retFlag = (HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "Setting-Up Profile " + profileTypeString + " for " + _projectName + " Version " + _projectVersion,
+                    "bash " + _cMakeCacheDir + "/builds/profile-" + profileTypeString + ".sh"));
+            std::cout << "Profiling " + _projectName + " Version " + _projectVersion;
+            std::cout << " with " + profileTypeString << std::endl;
+            retFlag = (retFlag && HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "bash " + _cMakeCacheDir + "/builds/profile-" + profileTypeString + ".make.sh"));
+
+            // Write-out the profiler reports and (sampled) stacks
+            retFlag = (retFlag && HiggsBoson::RunTypeSingleton::executeInContainer(
+                    "Writing Profile " + profileTypeString + " Reports for " + _projectName,
+                    "bash " + _cMakeCacheDir + "/builds/profile-" + profileTypeString + ".report.sh"));
+
+            // Aggregate the blocked time per stack and futex call site (if applicable)
+            if (retFlag && (profileType == ProfileType::OFF_CPU))
+            {
+                OffCpuProfile offCpuProfile;
+                retFlag = (offCpuProfile.readPerfScript(profileOutput + ".script")
+                        && offCpuProfile.writeFoldedStacks(profileOutput + ".folded")
+                        && offCpuProfile.writeReport(profileOutput + ".txt"));
+            }
+
+            // Aggregate the data cache misses per function and source line (if applicable)
+            if (retFlag && (profileType == ProfileType::CACHE))
+            {
+                CachegrindProfile cachegrindProfile;
+                std::string outputSuffix = ".cachegrind";
+                for (const auto& outputFile : Utils::listFilesInDirectory(profileOutputDir))
+                {
+                    if ((outputFile.rfind(profileOutput + ".", 0) == 0) && (outputFile != (profileOutput + outputSuffix))
+                            && (outputFile.size() > outputSuffix.size())
+                            && (outputFile.compare(outputFile.size() - outputSuffix.size(), outputSuffix.size(), outputSuffix) == 0))
+                        retFlag = (retFlag && cachegrindProfile.readCachegrindOutput(outputFile));
+                }
+                retFlag = (retFlag && cachegrindProfile.writeReport(profileOutput + ".txt"));
+            }
+
+            // Fold the sampled stacks and write-out the flame graph (if applicable)
+            // NOTE: The flame graphs are rendered natively so no external tooling is needed
+            if (retFlag && (profileType != ProfileType::CACHE))
+            {
+                FlameGraph flameGraph;
+                if (profileType == ProfileType::SAMPLER)
+                    retFlag = (flameGraph.readPerfScript(profileOutput + ".script")
+                            && flameGraph.writeFoldedStacks(profileOutput + ".folded"));
+                else
+                    retFlag = flameGraph.readFoldedStacks(profileOutput + ".folded");
+                std::string countName = ((profileType == ProfileType::OFF_CPU) ? "ns"
+                        : ((profileType == ProfileType::HEAP) ? "allocations" : "samples"));
+                std::string palette = ((profileType == ProfileType::OFF_CPU) ? "io"
+                        : ((profileType == ProfileType::HEAP) ? "mem" : "hot"));
+                retFlag = (retFlag && flameGraph.writeSvg(profileOutput + ".svg",
+                        _projectName + " " + profileTitle, countName, palette));
+            }
+
+            // Report the location of the profiling results
+            if (retFlag)
+                std::cout << "Profile results written to " << profileOutput
+                        << ((profileType == ProfileType::CACHE) ? ".txt" : ".svg") << std::endl;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to write the CMake file to the pre-defined location
+ *
+ * @param isTesting Boolean indicating whether to write-out a test or not
+ * @return Boolean indicating if the operation was successful or not
+ */
+bool CMakeSettings::writeCMakeFile(bool isTesting)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Setup the main source file based on if this is a test or not
+    std::string mainSourceFile;
+    if (!isTesting)
+        mainSourceFile = _mainFile;
+
+    // Open the sanitize-blacklist file
+    bool wroteSanitize = false;
+    auto sanitizeFile = FileWriter(_cMakeCacheDir + "/sanitize-blacklist.txt");
+    if (sanitizeFile.isOpen())
+    {
+
+        // Write-in the standard Higgs-Boson header for the sanitize-blacklist file
+        sanitizeFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        sanitizeFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        sanitizeFile.writeLine("");
+
+        // Write-in the standard sanitize-blacklist file information
+        sanitizeFile.writeLine("# Add external paths as black-list");
+        sanitizeFile.writeLine("src:*/external/output/*");
+        sanitizeFile.writeLine("src:*/external/catch2/*");
+        sanitizeFile.writeLine("src:*/lib/*");
+        sanitizeFile.writeLine("src:*/lib64/*");
+        sanitizeFile.writeLine("src:*/bin/*");
+
+        // Close the sanitize-blacklist file
+        sanitizeFile.close();
+
+        // If we get here, mark the operation as successful
+        wroteSanitize = true;
+    }
+
+    // Open the Catch2 Main Testing file
+    bool wroteCatch2 = false;
+    auto catch2File = FileWriter(_cMakeCacheDir + "/main.test.cpp.tmp");
+    if (catch2File.isOpen())
+    {
+
+        // Write-in the standard Higgs-Boson header for the Catch2 Main Testing file
+        catch2File.writeLine("// THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        catch2File.writeLine("// DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        catch2File.writeLine("");
+
+        // Write-in the standard Catch2 Main Testing file information
+        // NOTE: The tests themselves live in a separate translation unit so
+        //       that the (expensive) Catch2 main is only compiled once
+        catch2File.writeLine("// Boiler-plate setup for catch2");
+        catch2File.writeLine("#define CATCH_CONFIG_MAIN");
+        catch2File.writeLine("#include <catch.hpp>");
+
+        // Close the Catch2 Main Testing file
+        catch2File.close();
+
+        // If we get here, mark the operation as successful
+        wroteCatch2 = updateGeneratedFile(_cMakeCacheDir + "/main.test.cpp");
+    }
+
+    // Write-out the Catch2 Test shard files, each including a subset of the tests
+    // NOTE: Shards allow the tests to compile in parallel and limit re-compilation
+    //       to the shard which includes the changed testing file
+    bool wroteTests = true;
+    std::vector<std::string> testShardFiles;
+    auto testShards = getTestShards();
+    for (size_t shardIndex = 0; shardIndex < testShards.size(); shardIndex++)
+    {
+
+        // Open the Catch2 Test shard file
+        auto testShardFile = _cMakeCacheDir + "/tests-" + std::to_string(shardIndex) + ".test.cpp";
+        auto testsFile = FileWriter(testShardFile + ".tmp");
+        if (testsFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the Catch2 Test shard file
+            testsFile.writeLine("// THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            testsFile.writeLine("// DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            testsFile.writeLine("");
+
+            // Write-in the Catch2 include for the tests
+            testsFile.writeLine("#include <catch.hpp>");
+            testsFile.writeLine("");
+
+            // Write-in the testing include files for the shard
+            for (const auto& item : testShards[shardIndex])
+                testsFile.writeLine("#include \"" + item + "\"");
+
+            // Close the Catch2 Test shard file
+            testsFile.close();
+
+            // Keep track of the shard file for the CMake file
+            wroteTests = (updateGeneratedFile(testShardFile) && wroteTests);
+            testShardFiles.push_back(testShardFile);
+        }
+        else
+        {
+            wroteTests = false;
+        }
+    }
+
+    // Open the precompiled-header holder source file
+    bool wrotePch = false;
+    auto pchFile = FileWriter(_cMakeCacheDir + "/pch.cpp.tmp");
+    if (pchFile.isOpen())
+    {
+
+        // Write-in the standard Higgs-Boson header for the holder source file
+        // NOTE: The precompiled headers are force-included by CMake
+        pchFile.writeLine("// THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        pchFile.writeLine("// DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+
+        // Close the holder source file
+        pchFile.close();
+
+        // If we get here, mark the operation as successful
+        wrotePch = updateGeneratedFile(_cMakeCacheDir + "/pch.cpp");
+    }
+
+    // Write-out the benchmark harness and benchmark main file
+    bool wroteBench = writeBenchmarkHarness();
+
+    // Only continue if the sanitize and Catch2 operation was successful
+    if (wroteSanitize && wroteCatch2 && wroteTests && wrotePch && wroteBench)
+    {
+
+        // Open the CMake file
+        auto cMakeFile = FileWriter(_cMakeFile + ".tmp");
+        if (cMakeFile.isOpen())
+        {
+
+            // Write-in the standard Higgs-Boson header for the CMake file
+            cMakeFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            cMakeFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake minumum requirements information
+            cMakeFile.writeLine("# Setup the CMake minimum requirements");
+            cMakeFile.writeLine("cmake_minimum_required(VERSION 3.9.0)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake C++ standards information
+            cMakeFile.writeLine("# Set C++17 standard");
+            cMakeFile.writeLine("set(CMAKE_CXX_STANDARD 17)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake Higgs-Boson variables
+            cMakeFile.writeLine("# Higgs Build Variables");
+            cMakeFile.writeLine("set(HIGGS_PROJECT_NAME \"" + _projectName + "\")");
+            cMakeFile.writeLine("set(HIGGS_PROJECT_SRC \"" + _cMakeBuildDir + "\")");
+            cMakeFile.writeLine("set(HIGGS_PROJECT_CACHE \"" + _cMakeCacheDir + "\")");
+            cMakeFile.writeLine("set(HIGGS_PROJECT_VERSION \"" + _projectVersion + "\")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake Project details
+            cMakeFile.writeLine("# Project Specifics");
+            cMakeFile.writeLine("set(PROJECTNAME \"${HIGGS_PROJECT_NAME}\")");
+            cMakeFile.writeLine("project(${PROJECTNAME} CXX)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake Project targets
+            cMakeFile.writeLine("# Project Main Targets");
+            cMakeFile.writeLine("set(PROJECT_TARGET_MAIN \"${PROJECTNAME}\")");
+            cMakeFile.writeLine("set(PROJECT_TARGET_TEST \"${PROJECTNAME}_test\")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake Project outputs
+            cMakeFile.writeLine("# Project Outputs");
+            cMakeFile.writeLine("set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/lib)");
+            cMakeFile.writeLine("set(CMAKE_LIBRARY_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/lib)");
+            cMakeFile.writeLine("set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bin)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake
+            cMakeFile.writeLine("# Setup the project version");
+            cMakeFile.writeLine("set(VERSION \"${HIGGS_PROJECT_VERSION}\")");
+            cMakeFile.writeLine("");
+
+            // Setup toolchain CMAKE variables based on environment variables (if present)
+            cMakeFile.writeLine("# Setup toolchain CMAKE variables based on environment variables (if present)");
+            cMakeFile.writeLine("if(DEFINED ENV{CC})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"C Compiler Set To: $ENV{CC}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{CXX})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"C++ Compiler Set To: $ENV{CXX}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{CPP})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"CPP Compiler Set To: $ENV{CPP}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{AS})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Assembler Set To: $ENV{AS}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{AR})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Archiver Set To: $ENV{AR}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{LD})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Linker Set To: $ENV{LD}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{FC})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Fortran Compiler Set To: $ENV{FC}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Setup CMake cross-platform toolchain settings
+            // NOTE: Only set when present so re-configuring an existing build tree keeps its compilers
+            cMakeFile.writeLine("# Setup CMake cross-platform toolchain settings");
+            cMakeFile.writeLine("if(DEFINED ENV{CXX})");
+            cMakeFile.writeLine("    set(CMAKE_CXX_COMPILER \"$ENV{CXX}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{CC})");
+            cMakeFile.writeLine("    set(CMAKE_C_COMPILER \"$ENV{CC}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{AS})");
+            cMakeFile.writeLine("    set(CMAKE_ASM_COMPILER \"$ENV{AS}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{FC})");
+            cMakeFile.writeLine("    set(CMAKE_Fortran_COMPILER $ENV{FC})");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{LD})");
+            cMakeFile.writeLine("    set(CMAKE_SYSTEM_VERSION 1)");
+            cMakeFile.writeLine("    set(CMAKE_SYSROOT \"$ENV{HIGGS_BOSON_SYSROOT}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Setup default environment variables for cross-building
+            // TODO - Inject default value based on target OS for higgs-boson project itself
+            cMakeFile.writeLine("# Setup default environment variables for cross-building");
+            cMakeFile.writeLine("if(DEFINED ENV{HIGGS_BOSON_TARGET_OS})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Target OS Set To: $ENV{HIGGS_BOSON_TARGET_OS}\")");
+            cMakeFile.writeLine("else()");
+            cMakeFile.writeLine("    set(ENV{HIGGS_BOSON_TARGET_OS} linux)");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Target OS Set To: $ENV{HIGGS_BOSON_TARGET_OS}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{HIGGS_BOSON_TARGET_PLATFORM})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Platform Set To: $ENV{HIGGS_BOSON_TARGET_PLATFORM}\")");
+            cMakeFile.writeLine("else()");
+            cMakeFile.writeLine("    set(ENV{HIGGS_BOSON_TARGET_PLATFORM} linux-clang)");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Platform Set To: $ENV{HIGGS_BOSON_TARGET_PLATFORM}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(DEFINED ENV{HIGGS_BOSON_TARGET_ARCH})");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Architecture Set To: $ENV{HIGGS_BOSON_TARGET_ARCH}\")");
+            cMakeFile.writeLine("else()");
+            cMakeFile.writeLine("    set(ENV{HIGGS_BOSON_TARGET_ARCH} x86_64)");
+            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Architecture Set To: $ENV{HIGGS_BOSON_TARGET_ARCH}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Ensure the base-compiler variables are setup for local builds
+            cMakeFile.writeLine("# Ensure the base-compiler variables are setup for local builds");
+            cMakeFile.writeLine("if(NOT DEFINED CMAKE_C_COMPILER)");
+            cMakeFile.writeLine("    set(CMAKE_C_COMPILER /usr/bin/clang)");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(NOT DEFINED CMAKE_CXX_COMPILER)");
+            cMakeFile.writeLine("    set(CMAKE_CXX_COMPILER /usr/bin/clang++)");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Specify pre-processor macros for the current platform being built
+            cMakeFile.writeLine("# Specify pre-processor macros for the current platform being built");
+            cMakeFile.writeLine("add_compile_definitions(HIGGS_BOSON_TARGET_OS=$ENV{HIGGS_BOSON_TARGET_OS})");
+            cMakeFile.writeLine("add_compile_definitions(HIGGS_BOSON_TARGET_PLATFORM=$ENV{HIGGS_BOSON_TARGET_PLATFORM})");
+            cMakeFile.writeLine("add_compile_definitions(HIGGS_BOSON_TARGET_ARCH=$ENV{HIGGS_BOSON_TARGET_ARCH})");
+            cMakeFile.writeLine("");
+
+            // Write-in cross-compilation configuration
+            cMakeFile.writeLine("# Set Cross-Compilation Target Information");
+            cMakeFile.writeLine("set(CMAKE_HOST_SYSTEM_NAME Linux)");
+            cMakeFile.writeLine("set(CMAKE_SYSTEM_NAME $ENV{HIGGS_BOSON_TARGET_OS})");
+            cMakeFile.writeLine("set(CMAKE_CROSSCOMPILING ON)");
+            cMakeFile.writeLine("");
+            cMakeFile.writeLine("");
+
+            // Write in specifics to darwin (macos) related builds
+            cMakeFile.writeLine("# Specify specifics to darwin (macos) related builds");
+            cMakeFile.writeLine("if (CMAKE_SYSTEM_NAME STREQUAL darwin)");
+            cMakeFile.writeLine("    set(CMAKE_MACOSX_RPATH \"OFF\")");
+            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_PREFIX \"lib\")");
+            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_SUFFIX \".dylib\")");
+            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_SONAME_C_FLAG \"-install_name \")");
+            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_SONAME_CXX_FLAG \"-install_name \")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake source directories
+            cMakeFile.writeLine("# Setup the hard-coded source directory");
+            cMakeFile.writeLine("set(CMAKE_SOURCE_DIR ${HIGGS_PROJECT_SRC})");
+            cMakeFile.writeLine("set(CMAKE_CURRENT_SOURCE_DIR ${HIGGS_PROJECT_SRC})");
+            cMakeFile.writeLine("");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake external dependencies section
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("# Setup Internal (required) dependencies");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("");
+
+            // Write-in support for plibsys to handle platform specific things
+            cMakeFile.writeLine("# Add plibsys specific build parameters");
+            cMakeFile.writeLine("set(CMAKE_BUILD_TYPE, \"Release\")");
+            cMakeFile.writeLine("set(PLIBSYS_BUILD_STATIC, \"OFF\")");
+            cMakeFile.writeLine("set(CMAKE_C_COMPILER_ID, \"GNU\")");
+            cMakeFile.writeLine("set(PLIBSYS_TARGET_OS, \"$ENV{HIGGS_BOSON_TARGET_OS}\")");
+            cMakeFile.writeLine("set(PLIBSYS_TARGET_PLATFORM, \"$ENV{HIGGS_BOSON_TARGET_PLATFORM}\")");
+            cMakeFile.writeLine("set(CMAKE_SYSTEM_PROCESSOR, \"$ENV{HIGGS_BOSON_TARGET_ARCH}\")");
+            //cMakeFile.writeLine("add_subdirectory (${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson)");
+            cMakeFile.writeLine("include (${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson/platforms/$ENV{HIGGS_BOSON_TARGET_PLATFORM}/platform.cmake)");
+            cMakeFile.writeLine("include (${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson/cmake/PlatformDetect.cmake)");
+            cMakeFile.writeLine("plibsys_detect_target_os ($ENV{HIGGS_BOSON_TARGET_PLATFORM})");
+            cMakeFile.writeLine("MESSAGE(STATUS \"Platform-Specific Compiler Flags: ${PLIBSYS_PLATFORM_LINK_LIBRARIES}\")");
+            cMakeFile.writeLine("");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake external dependencies section
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("# Setup External dependencies");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake External includes files
+            cMakeFile.writeLine("# Add the include directories");
+            cMakeFile.writeLine("set(HIGGS_EXTERNAL_INCLUDES");
+            cMakeFile.writeLine("    ${CMAKE_BINARY_DIR}");
+            cMakeFile.writeLine("    \"${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson/src\"");
+            cMakeFile.writeLine("    \"${HIGGS_PROJECT_CACHE}/external/raw/catch2higgsboson/single_include/catch2\"");
+            for (const auto& item : _externalIncludes)
+                cMakeFile.writeLine("    \"" + item + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake external libraries files
+            cMakeFile.writeLine("# Setup the library and linker information");
+            cMakeFile.writeLine("set(HIGGS_EXTERNAL_LIBS");
+            for (auto libIndex = _externalLibraries.size(); libIndex > 0; libIndex--)
+                cMakeFile.writeLine("    \"" + _externalLibraries[libIndex - 1] + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake LLVM coverage information
+            cMakeFile.writeLine("# Add/Setup llvm coverage if desired/available");
+            cMakeFile.writeLine("SET(LLVM_COV_PATH \"/usr/bin/llvm-cov\")");
+            cMakeFile.writeLine("if(CMAKE_BUILD_TYPE STREQUAL \"coverage\" OR CODE_COVERAGE)");
+            cMakeFile.writeLine("    if(\"${CMAKE_C_COMPILER_ID}\" MATCHES \"(Apple)?[Cc]lang\" OR \"${CMAKE_CXX_COMPILER_ID}\" MATCHES \"(Apple)?[Cc]lang\")");
+            cMakeFile.writeLine("        message(\"Building with llvm Code Coverage Tools\")");
+            cMakeFile.writeLine("        # Warning/Error messages");
+            cMakeFile.writeLine("        if(NOT LLVM_COV_PATH)");
+            cMakeFile.writeLine("            message(FATAL_ERROR \"llvm-cov not found! Aborting.\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("        # set Flags");
+            cMakeFile.writeLine("        set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -fprofile-instr-generate -fcoverage-mapping\")");
+            cMakeFile.writeLine("        set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -fprofile-instr-generate -fcoverage-mapping\")");
+            cMakeFile.writeLine("    elseif(CMAKE_COMPILER_IS_GNUCXX)");
+            cMakeFile.writeLine("        message(\"Building with lcov Code Coverage Tools\")");
+            cMakeFile.writeLine("        # Warning/Error messages");
+            cMakeFile.writeLine("        if(NOT (CMAKE_BUILD_TYPE STREQUAL \"Debug\"))");
+            cMakeFile.writeLine("            message(WARNING \"Code coverage results with an optimized (non-Debug) build may be misleading\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("        if(NOT LCOV_PATH)");
+            cMakeFile.writeLine("            message(FATAL_ERROR \"lcov not found! Aborting...\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("        if(NOT GENHTML_PATH)");
+            cMakeFile.writeLine("            message(FATAL_ERROR \"genhtml not found! Aborting...\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("        set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} --coverage -fprofile-arcs -ftest-coverage\")");
+            cMakeFile.writeLine("        set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} --coverage -fprofile-arcs -ftest-coverage\")");
+            cMakeFile.writeLine("    else()");
+            cMakeFile.writeLine("        message(FATAL_ERROR \"Code coverage requires Clang or GCC. Aborting.\")");
+            cMakeFile.writeLine("    endif()");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake coverages flags
+            cMakeFile.writeLine("if(NOT CODE_COVERAGE)");
+            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -Wall\")");
+            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS}  -Wall\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake memory sanitizer flags
+            cMakeFile.writeLine("if(SANITIZE_MEMORY)");
+            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=memory -fsanitize-memory-track-origins -O1 -fno-optimize-sibling-calls -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=memory -fsanitize-memory-track-origins -O1 -fno-optimize-sibling-calls -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake address sanitizer flags
+            cMakeFile.writeLine("if(SANITIZE_ADDRESS)");
+            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=address -fno-omit-frame-pointer -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=address -fno-omit-frame-pointer -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake leak sanitizer flags
+            cMakeFile.writeLine("if(SANITIZE_LEAK)");
+            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=leak -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=leak -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake thread sanitizer flags
+            cMakeFile.writeLine("if(SANITIZE_THREAD)");
+            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=thread -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=thread -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake behavior sanitizer flags
+            cMakeFile.writeLine("if(SANITIZE_BEHAVIOR)");
+            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=undefined -fsanitize-minimal-runtime -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=undefined -fsanitize-minimal-runtime -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake link-time optimization information
+            // NOTE: ThinLTO is only available with clang (falling back to full LTO otherwise)
+            //       and its cache directory is only used if the linker accepts it
+            cMakeFile.writeLine("# Setup link-time optimization (off, thin, or full) if supported");
+            cMakeFile.writeLine("if(HIGGS_LTO AND NOT (HIGGS_LTO STREQUAL \"off\") AND NOT (CMAKE_BUILD_TYPE STREQUAL \"Debug\"))");
+            cMakeFile.writeLine("    include(CheckIPOSupported)");
+            cMakeFile.writeLine("    check_ipo_supported(RESULT HIGGS_LTO_SUPPORTED OUTPUT HIGGS_LTO_OUTPUT LANGUAGES CXX)");
+            cMakeFile.writeLine("    if(HIGGS_LTO_SUPPORTED)");
+            cMakeFile.writeLine("        set(CMAKE_INTERPROCEDURAL_OPTIMIZATION ON)");
+            cMakeFile.writeLine("        if((HIGGS_LTO STREQUAL \"thin\") AND (CMAKE_CXX_COMPILER_ID MATCHES \"(Apple)?[Cc]lang\"))");
+            cMakeFile.writeLine("            set(CMAKE_CXX_COMPILE_OPTIONS_IPO \"-flto=thin\")");
+            cMakeFile.writeLine("            include(CheckCXXSourceCompiles)");
+            cMakeFile.writeLine("            set(CMAKE_REQUIRED_FLAGS \"-flto=thin -Wl,--thinlto-cache-dir=${CMAKE_BINARY_DIR}/lto-cache\")");
+            cMakeFile.writeLine("            check_cxx_source_compiles(\"int main() { return 0; }\" HIGGS_LTO_THIN_CACHE)");
+            cMakeFile.writeLine("            unset(CMAKE_REQUIRED_FLAGS)");
+            cMakeFile.writeLine("            if(HIGGS_LTO_THIN_CACHE)");
+            cMakeFile.writeLine("                set(CMAKE_EXE_LINKER_FLAGS \"${CMAKE_EXE_LINKER_FLAGS} -Wl,--thinlto-cache-dir=${CMAKE_BINARY_DIR}/lto-cache\")");
+            cMakeFile.writeLine("                set(CMAKE_SHARED_LINKER_FLAGS \"${CMAKE_SHARED_LINKER_FLAGS} -Wl,--thinlto-cache-dir=${CMAKE_BINARY_DIR}/lto-cache\")");
+            cMakeFile.writeLine("            endif()");
+            cMakeFile.writeLine("        elseif(CMAKE_CXX_COMPILER_ID MATCHES \"(Apple)?[Cc]lang\")");
+            cMakeFile.writeLine("            set(CMAKE_CXX_COMPILE_OPTIONS_IPO \"-flto\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("        message(STATUS \"Link-Time Optimization Set To: ${HIGGS_LTO}\")");
+            cMakeFile.writeLine("    else()");
+            cMakeFile.writeLine("        message(WARNING \"Link-Time Optimization is not supported by the toolchain: ${HIGGS_LTO_OUTPUT}\")");
+            cMakeFile.writeLine("    endif()");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake linker and debug information settings
+            // NOTE: These are ELF-specific, so they only apply to Linux targets
+            cMakeFile.writeLine("# Setup the linker (default, lld, mold, or gold) and debug information (full, split, compressed, or none)");
+            cMakeFile.writeLine("if(NOT HIGGS_LINKER)");
+            cMakeFile.writeLine("    set(HIGGS_LINKER \"" + _linker + "\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(NOT HIGGS_DEBUG_INFO)");
+            cMakeFile.writeLine("    set(HIGGS_DEBUG_INFO \"" + _debugInfo + "\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(\"$ENV{HIGGS_BOSON_TARGET_OS}\" STREQUAL \"linux\")");
+            cMakeFile.writeLine("    foreach(HIGGS_DEBUG_CONFIG DEBUG RELWITHDEBINFO)");
+            cMakeFile.writeLine("        if(HIGGS_DEBUG_INFO STREQUAL \"split\")");
+            cMakeFile.writeLine("            set(CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG}} -gsplit-dwarf\")");
+            cMakeFile.writeLine("            set(CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG}} -gsplit-dwarf\")");
+            cMakeFile.writeLine("        elseif(HIGGS_DEBUG_INFO STREQUAL \"compressed\")");
+            cMakeFile.writeLine("            set(CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG}} -gz\")");
+            cMakeFile.writeLine("            set(CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG}} -gz\")");
+            cMakeFile.writeLine("            set(CMAKE_EXE_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_EXE_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG}} -gz\")");
+            cMakeFile.writeLine("            set(CMAKE_SHARED_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_SHARED_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG}} -gz\")");
+            cMakeFile.writeLine("        elseif(HIGGS_DEBUG_INFO STREQUAL \"none\")");
+            cMakeFile.writeLine("            set(CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG}} -g0\")");
+            cMakeFile.writeLine("            set(CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG}} -g0\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("    endforeach()");
+            cMakeFile.writeLine("    message(STATUS \"Debug Information Set To: ${HIGGS_DEBUG_INFO}\")");
+            cMakeFile.writeLine("    if(NOT (HIGGS_LINKER STREQUAL \"default\"))");
+            cMakeFile.writeLine("        find_program(HIGGS_LINKER_PATH_${HIGGS_LINKER} NAMES ld.${HIGGS_LINKER} ${HIGGS_LINKER})");
+            cMakeFile.writeLine("        if(HIGGS_LINKER_PATH_${HIGGS_LINKER})");
+            cMakeFile.writeLine("            set(CMAKE_EXE_LINKER_FLAGS \"${CMAKE_EXE_LINKER_FLAGS} -fuse-ld=${HIGGS_LINKER}\")");
+            cMakeFile.writeLine("            set(CMAKE_SHARED_LINKER_FLAGS \"${CMAKE_SHARED_LINKER_FLAGS} -fuse-ld=${HIGGS_LINKER}\")");
+            cMakeFile.writeLine("            if(NOT (HIGGS_DEBUG_INFO STREQUAL \"none\"))");
+            cMakeFile.writeLine("                foreach(HIGGS_DEBUG_CONFIG DEBUG RELWITHDEBINFO)");
+            cMakeFile.writeLine("                    set(CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_C_FLAGS_${HIGGS_DEBUG_CONFIG}} -ggnu-pubnames\")");
+            cMakeFile.writeLine("                    set(CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_CXX_FLAGS_${HIGGS_DEBUG_CONFIG}} -ggnu-pubnames\")");
+            cMakeFile.writeLine("                    set(CMAKE_EXE_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_EXE_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG}} -Wl,--gdb-index\")");
+            cMakeFile.writeLine("                    set(CMAKE_SHARED_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG} \"${CMAKE_SHARED_LINKER_FLAGS_${HIGGS_DEBUG_CONFIG}} -Wl,--gdb-index\")");
+            cMakeFile.writeLine("                endforeach()");
+            cMakeFile.writeLine("            endif()");
+            cMakeFile.writeLine("            message(STATUS \"Linker Set To: ${HIGGS_LINKER}\")");
+            cMakeFile.writeLine("        else()");
+            cMakeFile.writeLine("            message(WARNING \"The ${HIGGS_LINKER} linker was not found, using the default linker\")");
+            cMakeFile.writeLine("        endif()");
+            cMakeFile.writeLine("    endif()");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake build profile flags
+            cMakeFile.writeLine("# Setup the build profile compile and link flags (if provided)");
+            cMakeFile.writeLine("if(HIGGS_COMPILE_FLAGS)");
+            cMakeFile.writeLine("    add_compile_options(${HIGGS_COMPILE_FLAGS})");
+            cMakeFile.writeLine("    message(STATUS \"Profile Compile Flags Set To: ${HIGGS_COMPILE_FLAGS}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(HIGGS_LINK_FLAGS)");
+            cMakeFile.writeLine("    string(REPLACE \";\" \" \" HIGGS_LINK_FLAGS_STRING \"${HIGGS_LINK_FLAGS}\")");
+            cMakeFile.writeLine("    set(CMAKE_EXE_LINKER_FLAGS \"${CMAKE_EXE_LINKER_FLAGS} ${HIGGS_LINK_FLAGS_STRING}\")");
+            cMakeFile.writeLine("    set(CMAKE_SHARED_LINKER_FLAGS \"${CMAKE_SHARED_LINKER_FLAGS} ${HIGGS_LINK_FLAGS_STRING}\")");
+            cMakeFile.writeLine("    message(STATUS \"Profile Link Flags Set To: ${HIGGS_LINK_FLAGS_STRING}\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake compile-time profiling information
+            // NOTE: The per translation-unit time-traces are written next to each object file
+            cMakeFile.writeLine("# Setup compile-time profiling (per translation-unit time-traces) if supported");
+            cMakeFile.writeLine("if(HIGGS_TIME_TRACE)");
+            cMakeFile.writeLine("    if((CMAKE_CXX_COMPILER_ID MATCHES \"(Apple)?[Cc]lang\") AND NOT (CMAKE_CXX_COMPILER_VERSION VERSION_LESS 9))");
+            cMakeFile.writeLine("        add_compile_options(-ftime-trace)");
+            cMakeFile.writeLine("        message(STATUS \"Compile-Time Profiling Set To: ${HIGGS_TIME_TRACE}\")");
+            cMakeFile.writeLine("    else()");
+            cMakeFile.writeLine("        message(WARNING \"Compile-Time Profiling requires clang 9 or newer, ignoring it\")");
+            cMakeFile.writeLine("    endif()");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake profile-guided optimization information
+            // NOTE: Profiles are generated/merged with the llvm tooling, so this requires clang
+            cMakeFile.writeLine("# Setup profile-guided optimization (instrumented or profile-use) if supported");
+            cMakeFile.writeLine("if(HIGGS_PGO_GENERATE OR HIGGS_PGO_PROFILE)");
+            cMakeFile.writeLine("    if(NOT (CMAKE_CXX_COMPILER_ID MATCHES \"(Apple)?[Cc]lang\"))");
+            cMakeFile.writeLine("        message(WARNING \"Profile-Guided Optimization requires clang, ignoring it\")");
+            cMakeFile.writeLine("    elseif(HIGGS_PGO_GENERATE)");
+            cMakeFile.writeLine("        set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -fprofile-instr-generate\")");
+            cMakeFile.writeLine("        set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -fprofile-instr-generate\")");
+            cMakeFile.writeLine("        message(STATUS \"Profile-Guided Optimization Set To: generate\")");
+            cMakeFile.writeLine("    else()");
+            cMakeFile.writeLine("        set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -fprofile-instr-use=${HIGGS_PGO_PROFILE} -Wno-profile-instr-unprofiled\")");
+            cMakeFile.writeLine("        set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -fprofile-instr-use=${HIGGS_PGO_PROFILE} -Wno-profile-instr-unprofiled\")");
+            cMakeFile.writeLine("        message(STATUS \"Profile-Guided Optimization Set To: ${HIGGS_PGO_PROFILE}\")");
+            cMakeFile.writeLine("    endif()");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake R-path information
+            // TODO - Needs to be target-specific
+            //cMakeFile.writeLine("# Add in the higgs library linker location to the R-path");
+            //cMakeFile.writeLine("set(CMAKE_BUILD_RPATH \"/usr/lib/higgs-boson\")");
+            //cMakeFile.writeLine("set(CMAKE_INSTALL_RPATH  \"/usr/lib/higgs-boson\")");
+            //cMakeFile.writeLine("");
+
+            // Write-in the CMake main project target section
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("# Setup Target: Main Project");
+            cMakeFile.writeLine("#");
             cMakeFile.writeLine("");
 
-            // Write-in the CMake C++ standards information
-            cMakeFile.writeLine("# Set C++17 standard");
-            cMakeFile.writeLine("set(CMAKE_CXX_STANDARD 17)");
-            cMakeFile.writeLine("");
+            // Write-in the CMake external includes details
+            cMakeFile.writeLine("# Setup the include directories");
+            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_MAIN} PUBLIC $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/src>)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake include files
+            cMakeFile.writeLine("# Setup Headers");
+            cMakeFile.writeLine("set(${PROJECT_TARGET_MAIN}_headers");
+            for (const auto& item : _headerFiles)
+                cMakeFile.writeLine("        \"" + item.first + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake source files
+            cMakeFile.writeLine("# C++ Source Files");
+            cMakeFile.writeLine("set(${PROJECT_TARGET_MAIN}_sources");
+            for (const auto& item : _sourceFiles)
+                cMakeFile.writeLine("        \"" + item.first + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake precompiled headers
+            cMakeFile.writeLine("# Setup the precompiled headers (requires CMake 3.16+)");
+            cMakeFile.writeLine("set(HIGGS_PRECOMPILED_HEADERS");
+            for (const auto& item : getPrecompiledHeaders())
+                cMakeFile.writeLine("        \"" + item + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("set(HIGGS_TEST_PRECOMPILED_HEADERS ${HIGGS_PRECOMPILED_HEADERS})");
+            cMakeFile.writeLine("if(CATCH_TESTING)");
+            cMakeFile.writeLine("    list(APPEND HIGGS_TEST_PRECOMPILED_HEADERS \"<catch.hpp>\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("if(CMAKE_VERSION VERSION_LESS 3.16)");
+            cMakeFile.writeLine("    set(HIGGS_PRECOMPILED_HEADERS \"\")");
+            cMakeFile.writeLine("    set(HIGGS_TEST_PRECOMPILED_HEADERS \"\")");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake precompiled header target (shared between targets)
+            cMakeFile.writeLine("# Build the precompiled headers once for re-use across targets");
+            cMakeFile.writeLine("if(HIGGS_PRECOMPILED_HEADERS)");
+            cMakeFile.writeLine("    add_library(${PROJECT_TARGET_MAIN}_pch OBJECT ${HIGGS_PROJECT_CACHE}/pch.cpp)");
+            cMakeFile.writeLine("    target_precompile_headers(${PROJECT_TARGET_MAIN}_pch PRIVATE ${HIGGS_PRECOMPILED_HEADERS})");
+            if (mainSourceFile.empty())
+                cMakeFile.writeLine("    set_target_properties(${PROJECT_TARGET_MAIN}_pch PROPERTIES POSITION_INDEPENDENT_CODE ON)");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake project objects target information
+            // NOTE: Projects without sources (header-only or main-only) compile the
+            //       (empty) holder source so the objects target is never empty
+            cMakeFile.writeLine("# Compile the project sources once for both the main and test targets");
+            cMakeFile.writeLine("add_library(${PROJECT_TARGET_MAIN}_objects OBJECT");
+            if (_sourceFiles.empty())
+                cMakeFile.writeLine("        ${HIGGS_PROJECT_CACHE}/pch.cpp");
+            cMakeFile.writeLine("        ${${PROJECT_TARGET_MAIN}_sources} ${${PROJECT_TARGET_MAIN}_headers})");
+            if (mainSourceFile.empty())
+                cMakeFile.writeLine("set_target_properties(${PROJECT_TARGET_MAIN}_objects PROPERTIES POSITION_INDEPENDENT_CODE ON)");
+            cMakeFile.writeLine("if(HIGGS_PRECOMPILED_HEADERS)");
+            cMakeFile.writeLine("    target_precompile_headers(${PROJECT_TARGET_MAIN}_objects REUSE_FROM ${PROJECT_TARGET_MAIN}_pch)");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake main project target information
+            cMakeFile.writeLine("# Create the actual library for main project");
+            if (mainSourceFile.empty())
+                cMakeFile.writeLine("add_library(${PROJECT_TARGET_MAIN} SHARED ");
+            else
+                cMakeFile.writeLine("add_executable(${PROJECT_TARGET_MAIN} " + mainSourceFile);
+            cMakeFile.writeLine("        $<TARGET_OBJECTS:${PROJECT_TARGET_MAIN}_objects> ${${PROJECT_TARGET_MAIN}_headers})");
+            //cMakeFile.writeLine("add_dependencies(${PROJECT_TARGET_MAIN} plibsys)");
+            //cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_MAIN} plibsys)");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_MAIN} ${HIGGS_EXTERNAL_LIBS})");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_MAIN} ${PLIBSYS_PLATFORM_LINK_LIBRARIES})");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake main project precompiled headers
+            cMakeFile.writeLine("# Setup the precompiled headers for the main project");
+            cMakeFile.writeLine("if(HIGGS_PRECOMPILED_HEADERS)");
+            cMakeFile.writeLine("    target_precompile_headers(${PROJECT_TARGET_MAIN} REUSE_FROM ${PROJECT_TARGET_MAIN}_pch)");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake target includes details
+            cMakeFile.writeLine("# Setup include directories for the main project");
+            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_MAIN} \"${HIGGS_EXTERNAL_INCLUDES}\")");
+            cMakeFile.writeLine("");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake test target section
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("# Setup Target: Test Project");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake Catch-testing setup information
+            cMakeFile.writeLine("# Prepare \"Catch\" library for other executables");
+            cMakeFile.writeLine("set(TEST_INCLUDE_DIR ${CMAKE_CURRENT_SOURCE_DIR}/test)");
+            cMakeFile.writeLine("set(CATCH_INCLUDE_DIR ${CMAKE_CURRENT_SOURCE_DIR}/.higgs/external/raw/catch2higgsboson/single_include/catch2)");
+            cMakeFile.writeLine("add_library(Catch INTERFACE)");
+            cMakeFile.writeLine("target_include_directories(Catch INTERFACE ${CATCH_INCLUDE_DIR} ${TEST_INCLUDE_DIR})");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake include directories for testing
+            cMakeFile.writeLine("# Setup the include directories for the test target");
+            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} PUBLIC $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/src>)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake test source files
+            cMakeFile.writeLine("# Setup test sources");
+            cMakeFile.writeLine("set(TEST_SOURCES");
+            for (const auto& item : _testFiles)
+                cMakeFile.writeLine("        \"" + item.first + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake test shard source files
+            cMakeFile.writeLine("# Setup test shards");
+            cMakeFile.writeLine("set(TEST_SHARD_SOURCES");
+            for (const auto& item : testShardFiles)
+                cMakeFile.writeLine("        \"" + item + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake testing target
+            cMakeFile.writeLine("# Make the test executable");
+            cMakeFile.writeLine("add_executable(${PROJECT_TARGET_TEST} ${HIGGS_PROJECT_CACHE}/main.test.cpp ${TEST_SHARD_SOURCES} ${TEST_SOURCES}");
+            cMakeFile.writeLine("        $<TARGET_OBJECTS:${PROJECT_TARGET_MAIN}_objects> ${${PROJECT_TARGET_MAIN}_headers})");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake testing target precompiled headers
+            // NOTE: The Catch2 main must see CATCH_CONFIG_MAIN before catch.hpp so it is skipped
+            // NOTE: The test executable has its own precompiled headers (with catch.hpp)
+            //       so Catch2 is never force-included into the project objects
+            cMakeFile.writeLine("# Setup the precompiled headers for the test project");
+            cMakeFile.writeLine("if(HIGGS_TEST_PRECOMPILED_HEADERS)");
+            cMakeFile.writeLine("    target_precompile_headers(${PROJECT_TARGET_TEST} PRIVATE ${HIGGS_TEST_PRECOMPILED_HEADERS})");
+            cMakeFile.writeLine("    set_source_files_properties(${HIGGS_PROJECT_CACHE}/main.test.cpp PROPERTIES SKIP_PRECOMPILE_HEADERS ON)");
+            cMakeFile.writeLine("endif()");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake include source/headers for testing targets
+            cMakeFile.writeLine("# Setup include directories for the test project");
+            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} \"${CMAKE_SOURCE_DIR}/src\")");
+            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} \"${CMAKE_SOURCE_DIR}/test\")");
+            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} \"${HIGGS_EXTERNAL_INCLUDES}\")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake testing target libraries information
+            cMakeFile.writeLine("# Setup the test target");
+            //cMakeFile.writeLine("add_dependencies(${PROJECT_TARGET_TEST} plibsys)");
+            //cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} plibsys)");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} ${HIGGS_EXTERNAL_LIBS})");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} ${PLIBSYS_PLATFORM_LINK_LIBRARIES})");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} Catch)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake testing compile definitions
+            cMakeFile.writeLine("# Setup Testing definitions");
+            cMakeFile.writeLine("target_compile_definitions(${PROJECT_TARGET_TEST} PRIVATE CATCH_TESTING=1)");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake testing LLVM coverage information
+            // NOTE: Each test process writes its own profile (%p/%m) which are merged in parallel
+            cMakeFile.writeLine("# Setup the LLVM Coverage Target");
+            cMakeFile.writeLine("cmake_host_system_information(RESULT HIGGS_COVERAGE_JOBS QUERY NUMBER_OF_LOGICAL_CORES)");
+            cMakeFile.writeLine("add_custom_target(${PROJECT_TARGET_TEST}_coverage");
+            cMakeFile.writeLine("        COMMAND ${CMAKE_COMMAND} -E remove_directory ${CMAKE_BINARY_DIR}/profraw");
+            cMakeFile.writeLine("        COMMAND ${CMAKE_COMMAND} -E env LLVM_PROFILE_FILE=${CMAKE_BINARY_DIR}/profraw/${PROJECT_TARGET_TEST}-%p-%m.profraw $<TARGET_FILE:${PROJECT_TARGET_TEST}>");
+            cMakeFile.writeLine("        COMMAND sh -c \"llvm-profdata merge -sparse -j ${HIGGS_COVERAGE_JOBS} ${CMAKE_BINARY_DIR}/profraw/*.profraw -o ${PROJECT_TARGET_TEST}.profdata\"");
+            cMakeFile.writeLine("        COMMAND llvm-cov report $<TARGET_FILE:${PROJECT_TARGET_TEST}> -instr-profile=${PROJECT_TARGET_TEST}.profdata ${CMAKE_SOURCE_DIR}/src");
+            cMakeFile.writeLine("        COMMAND llvm-cov show $<TARGET_FILE:${PROJECT_TARGET_TEST}> -instr-profile=${PROJECT_TARGET_TEST}.profdata -show-line-counts-or-regions -output-dir=${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/llvm-coverage -format=\"html\" ${CMAKE_SOURCE_DIR}/src");
+            cMakeFile.writeLine("        COMMAND echo \"${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/llvm-coverage/index.html in your browser to view the coverage report.\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake benchmark target section
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("# Setup Target: Benchmark Project");
+            cMakeFile.writeLine("#");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake benchmark source files
+            cMakeFile.writeLine("# Setup benchmark sources");
+            cMakeFile.writeLine("set(PROJECT_TARGET_BENCH \"${PROJECTNAME}_bench\")");
+            cMakeFile.writeLine("set(BENCH_SOURCES");
+            for (const auto& item : _benchmarkFiles)
+                cMakeFile.writeLine("        \"" + item.first + "\"");
+            cMakeFile.writeLine(")");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake benchmark target (linked against the bundled harness)
+            cMakeFile.writeLine("# Make the benchmark executable");
+            cMakeFile.writeLine("add_executable(${PROJECT_TARGET_BENCH} ${HIGGS_PROJECT_CACHE}/main.bench.cpp ${BENCH_SOURCES}");
+            cMakeFile.writeLine("        $<TARGET_OBJECTS:${PROJECT_TARGET_MAIN}_objects> ${${PROJECT_TARGET_MAIN}_headers})");
+            cMakeFile.writeLine("target_include_directories(${PROJECT_TARGET_BENCH} PRIVATE ${HIGGS_PROJECT_CACHE})");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_BENCH} ${HIGGS_EXTERNAL_LIBS})");
+            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_BENCH} ${PLIBSYS_PLATFORM_LINK_LIBRARIES})");
+            cMakeFile.writeLine("");
+
+            // Write-in the CMake benchmark target precompiled headers
+            // NOTE: Library objects are position-independent so the benchmark executable
+            //       needs its own precompiled headers in that case
+            cMakeFile.writeLine("# Setup the precompiled headers for the benchmark project");
+            cMakeFile.writeLine("if(HIGGS_PRECOMPILED_HEADERS)");
+            if (mainSourceFile.empty())
+                cMakeFile.writeLine("    target_precompile_headers(${PROJECT_TARGET_BENCH} PRIVATE ${HIGGS_PRECOMPILED_HEADERS})");
+            else
+                cMakeFile.writeLine("    target_precompile_headers(${PROJECT_TARGET_BENCH} REUSE_FROM ${PROJECT_TARGET_MAIN}_pch)");
+            cMakeFile.writeLine("endif()");
+
+            // Close the CMake file
+            cMakeFile.close();
+
+            // If we get here, mark the operation as successful
+            retFlag = updateGeneratedFile(_cMakeFile);
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to write the (bundled) benchmark harness and the
+ * benchmark main file (including the benchmark files) to the cache directory
+ *
+ * @return Boolean indicating if the operation was successful or not
+ */
+bool CMakeSettings::writeBenchmarkHarness()
+{
+
+    // Open the benchmark harness header file
+    // NOTE: Benchmarks include it as <higgs-bench.hpp> and are defined as:
+    //       HIGGS_BENCHMARK ("Name") { while (state.keepRunning()) { ... } }
+    bool wroteHarness = false;
+    auto harnessFile = FileWriter(_cMakeCacheDir + "/higgs-bench.hpp.tmp");
+    if (harnessFile.isOpen())
+    {
+
+        // Write-in the benchmark harness header
+        harnessFile.writeLine("// THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        harnessFile.writeLine("// DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("#ifndef HIGGS_BENCH_HPP");
+        harnessFile.writeLine("#define HIGGS_BENCH_HPP");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("#include <atomic>");
+        harnessFile.writeLine("#include <chrono>");
+        harnessFile.writeLine("#include <cstdint>");
+        harnessFile.writeLine("#include <string>");
+        harnessFile.writeLine("#include <vector>");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("namespace HiggsBench");
+        harnessFile.writeLine("{");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("    // Heap allocation counter (maintained by the benchmark executable)");
+        harnessFile.writeLine("    inline std::atomic<std::uint64_t>& allocationCount()");
+        harnessFile.writeLine("    {");
+        harnessFile.writeLine("        static std::atomic<std::uint64_t> count(0);");
+        harnessFile.writeLine("        return count;");
+        harnessFile.writeLine("    }");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("    // Benchmark state used to drive the timed loop: while (state.keepRunning()) { ... }");
+        harnessFile.writeLine("    class State");
+        harnessFile.writeLine("    {");
+        harnessFile.writeLine("        private:");
+        harnessFile.writeLine("            std::uint64_t _iterations;");
+        harnessFile.writeLine("            std::uint64_t _count;");
+        harnessFile.writeLine("            std::uint64_t _allocations;");
+        harnessFile.writeLine("            bool _completed;");
+        harnessFile.writeLine("            std::chrono::steady_clock::time_point _start;");
+        harnessFile.writeLine("            std::chrono::steady_clock::time_point _end;");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("        public:");
+        harnessFile.writeLine("            explicit State(std::uint64_t iterations)");
+        harnessFile.writeLine("                : _iterations(iterations), _count(0), _allocations(0), _completed(false) {}");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("            bool keepRunning()");
+        harnessFile.writeLine("            {");
+        harnessFile.writeLine("                if (_count == 0)");
+        harnessFile.writeLine("                {");
+        harnessFile.writeLine("                    _allocations = allocationCount().load(std::memory_order_relaxed);");
+        harnessFile.writeLine("                    _start = std::chrono::steady_clock::now();");
+        harnessFile.writeLine("                }");
+        harnessFile.writeLine("                if (_count < _iterations)");
+        harnessFile.writeLine("                {");
+        harnessFile.writeLine("                    _count++;");
+        harnessFile.writeLine("                    return true;");
+        harnessFile.writeLine("                }");
+        harnessFile.writeLine("                _end = std::chrono::steady_clock::now();");
+        harnessFile.writeLine("                _allocations = (allocationCount().load(std::memory_order_relaxed) - _allocations);");
+        harnessFile.writeLine("                _completed = true;");
+        harnessFile.writeLine("                return false;");
+        harnessFile.writeLine("            }");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("            std::uint64_t iterations() const { return _iterations; }");
+        harnessFile.writeLine("            bool completed() const { return _completed; }");
+        harnessFile.writeLine("            std::uint64_t allocations() const { return _allocations; }");
+        harnessFile.writeLine("            double elapsedNanoseconds() const");
+        harnessFile.writeLine("            {");
+        harnessFile.writeLine("                return std::chrono::duration<double, std::nano>(_end - _start).count();");
+        harnessFile.writeLine("            }");
+        harnessFile.writeLine("    };");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("    // Function used to keep the compiler from optimizing away a value");
+        harnessFile.writeLine("    template <typename T>");
+        harnessFile.writeLine("    inline void doNotOptimize(T const& value)");
+        harnessFile.writeLine("    {");
+        harnessFile.writeLine("        asm volatile(\"\" : : \"g\"(&value) : \"memory\");");
+        harnessFile.writeLine("    }");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("    // Registered benchmark information");
+        harnessFile.writeLine("    struct Benchmark");
+        harnessFile.writeLine("    {");
+        harnessFile.writeLine("        std::string name;");
+        harnessFile.writeLine("        void (*function)(State&);");
+        harnessFile.writeLine("    };");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("    inline std::vector<Benchmark>& registry()");
+        harnessFile.writeLine("    {");
+        harnessFile.writeLine("        static std::vector<Benchmark> benchmarks;");
+        harnessFile.writeLine("        return benchmarks;");
+        harnessFile.writeLine("    }");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("    struct Registrar");
+        harnessFile.writeLine("    {");
+        harnessFile.writeLine("        Registrar(const char* name, void (*function)(State&))");
+        harnessFile.writeLine("        {");
+        harnessFile.writeLine("            registry().push_back({name, function});");
+        harnessFile.writeLine("        }");
+        harnessFile.writeLine("    };");
+        harnessFile.writeLine("}");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("// Macros used to define/register a benchmark: HIGGS_BENCHMARK (\"Name\") { ... }");
+        harnessFile.writeLine("#define HIGGS_BENCHMARK_CONCAT_IMPL(first, second) first##second");
+        harnessFile.writeLine("#define HIGGS_BENCHMARK_CONCAT(first, second) HIGGS_BENCHMARK_CONCAT_IMPL(first, second)");
+        harnessFile.writeLine("#define HIGGS_BENCHMARK_IMPL(name, id) \\");
+        harnessFile.writeLine("    static void HIGGS_BENCHMARK_CONCAT(higgsBenchmark, id)(HiggsBench::State& state); \\");
+        harnessFile.writeLine("    static HiggsBench::Registrar HIGGS_BENCHMARK_CONCAT(higgsBenchmarkRegistrar, id)(name, \\");
+        harnessFile.writeLine("            &HIGGS_BENCHMARK_CONCAT(higgsBenchmark, id)); \\");
+        harnessFile.writeLine("    static void HIGGS_BENCHMARK_CONCAT(higgsBenchmark, id)(HiggsBench::State& state)");
+        harnessFile.writeLine("#define HIGGS_BENCHMARK(name) HIGGS_BENCHMARK_IMPL(name, __COUNTER__)");
+        harnessFile.writeLine("");
+        harnessFile.writeLine("#endif //HIGGS_BENCH_HPP");
+
+        // Close the benchmark harness header file
+        harnessFile.close();
+
+        // If we get here, mark the operation as successful
+        wroteHarness = updateGeneratedFile(_cMakeCacheDir + "/higgs-bench.hpp");
+    }
+
+    // Open the benchmark main file
+    bool wroteMain = false;
+    auto benchFile = FileWriter(_cMakeCacheDir + "/main.bench.cpp.tmp");
+    if (benchFile.isOpen())
+    {
+
+        // Write-in the benchmark runner (allocation counting, calibration, and results)
+        benchFile.writeLine("// THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        benchFile.writeLine("// DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        benchFile.writeLine("");
+        benchFile.writeLine("#include <new>");
+        benchFile.writeLine("#include <algorithm>");
+        benchFile.writeLine("#include <cmath>");
+        benchFile.writeLine("#include <cstdlib>");
+        benchFile.writeLine("#include <fstream>");
+        benchFile.writeLine("#include <iomanip>");
+        benchFile.writeLine("#include <iostream>");
+        benchFile.writeLine("#include <higgs-bench.hpp>");
+        benchFile.writeLine("");
+        benchFile.writeLine("// Count the heap allocations made by the benchmarks");
+        benchFile.writeLine("void* operator new(std::size_t size)");
+        benchFile.writeLine("{");
+        benchFile.writeLine("    HiggsBench::allocationCount().fetch_add(1, std::memory_order_relaxed);");
+        benchFile.writeLine("    if (void* pointer = std::malloc((size == 0) ? 1 : size))");
+        benchFile.writeLine("        return pointer;");
+        benchFile.writeLine("    throw std::bad_alloc();");
+        benchFile.writeLine("}");
+        benchFile.writeLine("void* operator new[](std::size_t size) { return operator new(size); }");
+        benchFile.writeLine("void operator delete(void* pointer) noexcept { std::free(pointer); }");
+        benchFile.writeLine("void operator delete[](void* pointer) noexcept { std::free(pointer); }");
+        benchFile.writeLine("void operator delete(void* pointer, std::size_t) noexcept { std::free(pointer); }");
+        benchFile.writeLine("void operator delete[](void* pointer, std::size_t) noexcept { std::free(pointer); }");
+        benchFile.writeLine("");
+        benchFile.writeLine("namespace HiggsBench");
+        benchFile.writeLine("{");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Measured results for a single benchmark");
+        benchFile.writeLine("    struct Result");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        std::string name;");
+        benchFile.writeLine("        std::uint64_t iterations;");
+        benchFile.writeLine("        std::vector<double> samples;");
+        benchFile.writeLine("        double mean;");
+        benchFile.writeLine("        double variance;");
+        benchFile.writeLine("        double allocations;");
+        benchFile.writeLine("    };");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Function used to match a benchmark name against a wild-card (*) filter");
+        benchFile.writeLine("    bool matchesFilter(const char* name, const char* filter)");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        if (*filter == '\\0')");
+        benchFile.writeLine("            return (*name == '\\0');");
+        benchFile.writeLine("        if (*filter == '*')");
+        benchFile.writeLine("            return (matchesFilter(name, filter + 1) || ((*name != '\\0') && matchesFilter(name + 1, filter)));");
+        benchFile.writeLine("        return ((*name == *filter) && matchesFilter(name + 1, filter + 1));");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Function used to escape a string for JSON output");
+        benchFile.writeLine("    std::string escapeJson(const std::string& value)");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        std::string escaped;");
+        benchFile.writeLine("        for (auto character : value)");
+        benchFile.writeLine("        {");
+        benchFile.writeLine("            if ((character == '\"') || (character == '\\\\'))");
+        benchFile.writeLine("                escaped += '\\\\';");
+        benchFile.writeLine("            escaped += character;");
+        benchFile.writeLine("        }");
+        benchFile.writeLine("        return escaped;");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Function used to calibrate and run a benchmark's samples");
+        benchFile.writeLine("    bool runBenchmark(const Benchmark& benchmark, double minSampleNanoseconds, unsigned int sampleCount, Result& result)");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("");
+        benchFile.writeLine("        // Grow the iterations until a single sample runs for the minimum time");
+        benchFile.writeLine("        std::uint64_t iterations = 1;");
+        benchFile.writeLine("        while (true)");
+        benchFile.writeLine("        {");
+        benchFile.writeLine("            State state(iterations);");
+        benchFile.writeLine("            benchmark.function(state);");
+        benchFile.writeLine("            if (!state.completed())");
+        benchFile.writeLine("                return false;");
+        benchFile.writeLine("            double elapsed = state.elapsedNanoseconds();");
+        benchFile.writeLine("            if ((elapsed >= minSampleNanoseconds) || (iterations >= 1000000000ULL))");
+        benchFile.writeLine("                break;");
+        benchFile.writeLine("            double scale = ((elapsed > 0) ? ((minSampleNanoseconds * 1.2) / elapsed) : 100.0);");
+        benchFile.writeLine("            iterations = static_cast<std::uint64_t>(iterations * std::min(std::max(scale, 2.0), 100.0));");
+        benchFile.writeLine("        }");
+        benchFile.writeLine("");
+        benchFile.writeLine("        // Run the timed samples");
+        benchFile.writeLine("        std::uint64_t allocations = 0;");
+        benchFile.writeLine("        result.name = benchmark.name;");
+        benchFile.writeLine("        result.iterations = iterations;");
+        benchFile.writeLine("        for (unsigned int sampleIndex = 0; sampleIndex < sampleCount; sampleIndex++)");
+        benchFile.writeLine("        {");
+        benchFile.writeLine("            State state(iterations);");
+        benchFile.writeLine("            benchmark.function(state);");
+        benchFile.writeLine("            if (!state.completed())");
+        benchFile.writeLine("                return false;");
+        benchFile.writeLine("            result.samples.push_back(state.elapsedNanoseconds() / iterations);");
+        benchFile.writeLine("            allocations += state.allocations();");
+        benchFile.writeLine("        }");
+        benchFile.writeLine("");
+        benchFile.writeLine("        // Calculate the statistics for the samples");
+        benchFile.writeLine("        result.mean = 0;");
+        benchFile.writeLine("        for (auto sample : result.samples)");
+        benchFile.writeLine("            result.mean += sample;");
+        benchFile.writeLine("        result.mean /= result.samples.size();");
+        benchFile.writeLine("        result.variance = 0;");
+        benchFile.writeLine("        for (auto sample : result.samples)");
+        benchFile.writeLine("            result.variance += ((sample - result.mean) * (sample - result.mean));");
+        benchFile.writeLine("        result.variance /= ((result.samples.size() > 1) ? (result.samples.size() - 1) : 1);");
+        benchFile.writeLine("        result.allocations = (static_cast<double>(allocations) / (iterations * sampleCount));");
+        benchFile.writeLine("        return true;");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("}");
+        benchFile.writeLine("");
+        benchFile.writeLine("// Main function used to run the (filtered) benchmarks:");
+        benchFile.writeLine("// <bench> [filter] [--json file] [--tsv file] [--samples N] [--min-time-ms N]");
+        benchFile.writeLine("int main(int argc, char* argv[])");
+        benchFile.writeLine("{");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Parse the command-line arguments");
+        benchFile.writeLine("    std::string filter = \"*\";");
+        benchFile.writeLine("    std::string jsonPath;");
+        benchFile.writeLine("    std::string tsvPath;");
+        benchFile.writeLine("    unsigned int sampleCount = 10;");
+        benchFile.writeLine("    double minSampleNanoseconds = 10000000.0;");
+        benchFile.writeLine("    for (int argIndex = 1; argIndex < argc; argIndex++)");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        std::string argument = argv[argIndex];");
+        benchFile.writeLine("        if ((argument == \"--json\") && ((argIndex + 1) < argc))");
+        benchFile.writeLine("            jsonPath = argv[++argIndex];");
+        benchFile.writeLine("        else if ((argument == \"--tsv\") && ((argIndex + 1) < argc))");
+        benchFile.writeLine("            tsvPath = argv[++argIndex];");
+        benchFile.writeLine("        else if ((argument == \"--samples\") && ((argIndex + 1) < argc))");
+        benchFile.writeLine("            sampleCount = std::max(2, std::atoi(argv[++argIndex]));");
+        benchFile.writeLine("        else if ((argument == \"--min-time-ms\") && ((argIndex + 1) < argc))");
+        benchFile.writeLine("            minSampleNanoseconds = (std::atof(argv[++argIndex]) * 1000000.0);");
+        benchFile.writeLine("        else if (!argument.empty())");
+        benchFile.writeLine("            filter = ((argument.find('*') == std::string::npos) ? (\"*\" + argument + \"*\") : argument);");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Run each of the matching benchmarks");
+        benchFile.writeLine("    bool success = true;");
+        benchFile.writeLine("    std::vector<HiggsBench::Result> results;");
+        benchFile.writeLine("    for (const auto& benchmark : HiggsBench::registry())");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        if (!HiggsBench::matchesFilter(benchmark.name.c_str(), filter.c_str()))");
+        benchFile.writeLine("            continue;");
+        benchFile.writeLine("        HiggsBench::Result result;");
+        benchFile.writeLine("        if (!HiggsBench::runBenchmark(benchmark, minSampleNanoseconds, sampleCount, result))");
+        benchFile.writeLine("        {");
+        benchFile.writeLine("            std::cout << benchmark.name << \": the benchmark must loop on state.keepRunning()\" << std::endl;");
+        benchFile.writeLine("            success = false;");
+        benchFile.writeLine("            continue;");
+        benchFile.writeLine("        }");
+        benchFile.writeLine("        std::cout << std::left << std::setw(40) << result.name << std::right << std::fixed << std::setprecision(2)");
+        benchFile.writeLine("                << std::setw(14) << result.mean << \" ns/op  +/- \" << std::setw(6)");
+        benchFile.writeLine("                << ((result.mean > 0) ? (100.0 * std::sqrt(result.variance) / result.mean) : 0.0) << \"%\"");
+        benchFile.writeLine("                << std::setw(14) << result.iterations << \" iterations\"");
+        benchFile.writeLine("                << std::setw(10) << result.allocations << \" allocs/op\" << std::endl;");
+        benchFile.writeLine("        results.push_back(result);");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("    if (results.empty() && success)");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        std::cout << \"No benchmarks matched the filter: \" << filter << std::endl;");
+        benchFile.writeLine("        success = false;");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Write-out the machine-readable JSON results (if requested)");
+        benchFile.writeLine("    if (!jsonPath.empty())");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        std::ofstream jsonFile(jsonPath);");
+        benchFile.writeLine("        jsonFile << std::setprecision(17) << \"{\" << std::endl << \"  \\\"benchmarks\\\": [\" << std::endl;");
+        benchFile.writeLine("        for (size_t resultIndex = 0; resultIndex < results.size(); resultIndex++)");
+        benchFile.writeLine("        {");
+        benchFile.writeLine("            const auto& result = results[resultIndex];");
+        benchFile.writeLine("            jsonFile << \"    {\\\"name\\\": \\\"\" << HiggsBench::escapeJson(result.name) << \"\\\"\"");
+        benchFile.writeLine("                    << \", \\\"ns_per_op\\\": \" << result.mean");
+        benchFile.writeLine("                    << \", \\\"variance\\\": \" << result.variance");
+        benchFile.writeLine("                    << \", \\\"iterations\\\": \" << result.iterations");
+        benchFile.writeLine("                    << \", \\\"allocations_per_op\\\": \" << result.allocations");
+        benchFile.writeLine("                    << \", \\\"samples_ns_per_op\\\": [\";");
+        benchFile.writeLine("            for (size_t sampleIndex = 0; sampleIndex < result.samples.size(); sampleIndex++)");
+        benchFile.writeLine("                jsonFile << ((sampleIndex > 0) ? \", \" : \"\") << result.samples[sampleIndex];");
+        benchFile.writeLine("            jsonFile << \"]}\" << (((resultIndex + 1) < results.size()) ? \",\" : \"\") << std::endl;");
+        benchFile.writeLine("        }");
+        benchFile.writeLine("        jsonFile << \"  ]\" << std::endl << \"}\" << std::endl;");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Write-out the machine-readable TSV results (if requested)");
+        benchFile.writeLine("    if (!tsvPath.empty())");
+        benchFile.writeLine("    {");
+        benchFile.writeLine("        std::ofstream tsvFile(tsvPath);");
+        benchFile.writeLine("        tsvFile << std::setprecision(17) << \"name\\tns_per_op\\tvariance\\titerations\\tallocations_per_op\" << std::endl;");
+        benchFile.writeLine("        for (const auto& result : results)");
+        benchFile.writeLine("            tsvFile << result.name << \"\\t\" << result.mean << \"\\t\" << result.variance << \"\\t\"");
+        benchFile.writeLine("                    << result.iterations << \"\\t\" << result.allocations << std::endl;");
+        benchFile.writeLine("    }");
+        benchFile.writeLine("");
+        benchFile.writeLine("    // Return the status of the benchmarks");
+        benchFile.writeLine("    return (success ? 0 : 1);");
+        benchFile.writeLine("}");
+
+        // Write-in the benchmark include files
+        benchFile.writeLine("");
+        std::vector<std::string> benchmarkFiles;
+        for (const auto& item : _benchmarkFiles)
+            benchmarkFiles.push_back(item.first);
+        std::sort(benchmarkFiles.begin(), benchmarkFiles.end());
+        for (const auto& benchmarkFile : benchmarkFiles)
+            benchFile.writeLine("#include \"" + benchmarkFile + "\"");
+
+        // Close the benchmark main file
+        benchFile.close();
+
+        // If we get here, mark the operation as successful
+        wroteMain = updateGeneratedFile(_cMakeCacheDir + "/main.bench.cpp");
+    }
+
+    // Return whether both files were written
+    return (wroteHarness && wroteMain);
+}
+
+/**
+ * Internal function used to read the per-sample timings from benchmark results
+ *
+ * @param resultsPath String representing the path to the JSON results
+ * @return Map of Strings to Vectors of Doubles representing the benchmarks' samples
+ */
+std::map<std::string, std::vector<double>> CMakeSettings::readBenchmarkResults(const std::string& resultsPath)
+{
+
+    // Create the return map
+    std::map<std::string, std::vector<double>> retMap;
+
+    // Read-in the results line-by-line
+    // NOTE: The benchmark harness writes-out one benchmark per line
+    std::ifstream resultsFile(resultsPath);
+    std::string line;
+    std::string nameKey = "{\"name\": \"";
+    std::string samplesKey = "\"samples_ns_per_op\": [";
+    while (std::getline(resultsFile, line))
+    {
+
+        // Only continue if the line describes a benchmark
+        auto nameStart = line.find(nameKey);
+        auto samplesStart = line.find(samplesKey);
+        if ((nameStart == std::string::npos) || (samplesStart == std::string::npos))
+            continue;
+
+        // Read-in (and un-escape) the benchmark's name
+        std::string name;
+        for (auto index = nameStart + nameKey.size(); (index < line.size()) && (line[index] != '"'); index++)
+        {
+            if ((line[index] == '\\') && ((index + 1) < line.size()))
+                index++;
+            name += line[index];
+        }
+
+        // Read-in the benchmark's samples
+        auto samplesEnd = line.find(']', samplesStart);
+        std::string samplesString = line.substr(samplesStart + samplesKey.size(),
+                samplesEnd - (samplesStart + samplesKey.size()));
+        for (auto sample : Utils::splitStringByDelimiter(samplesString, ','))
+            if (!Utils::trim(sample).empty())
+                retMap[name].push_back(std::strtod(sample.c_str(), nullptr));
+    }
+
+    // Return the return map
+    return retMap;
+}
+
+/**
+ * Internal function used to compare benchmark results against a saved baseline
+ *
+ * @param resultsPath String representing the path to the JSON results
+ * @param baseline String representing the name of the baseline to compare against
+ * @return Boolean indicating whether no benchmark regressed against the baseline
+ */
+bool CMakeSettings::compareBenchmarkResults(const std::string& resultsPath, const std::string& baseline)
+{
+
+    // Create a return flag
+    bool retFlag = true;
+
+    // Read-in both the baseline and current results
+    auto baselineResults = readBenchmarkResults(_cMakeCacheDir + "/bench/" + baseline + ".json");
+    auto currentResults = readBenchmarkResults(resultsPath);
+
+    // Define a function used to get the median of a set of samples
+    auto getMedian = [](std::vector<double> samples)
+    {
+        std::sort(samples.begin(), samples.end());
+        auto middle = samples.size() / 2;
+        return ((samples.size() % 2) == 0)
+                ? ((samples[middle - 1] + samples[middle]) / 2.0) : samples[middle];
+    };
+
+    // Compare each of the current benchmarks against the baseline
+    // NOTE: Changes are measured between medians and only count when
+    //       the samples differ significantly (Mann-Whitney U test)
+    std::cout << "Comparing Benchmarks against Baseline \"" << baseline << "\" (Threshold: "
+            << _benchRegressionThreshold << "%, Significance: " << _benchSignificance << ")" << std::endl;
+    for (const auto& currentResult : currentResults)
+    {
+
+        // Handle benchmarks without a baseline (nothing to compare against)
+        auto baselineResult = baselineResults.find(currentResult.first);
+        if ((baselineResult == baselineResults.end())
+                || baselineResult->second.empty() || currentResult.second.empty())
+        {
+            std::cout << "    " << std::left << std::setw(40) << currentResult.first << " NEW" << std::endl;
+            continue;
+        }
+
+        // Calculate the change and its significance
+        auto baselineMedian = getMedian(baselineResult->second);
+        auto currentMedian = getMedian(currentResult.second);
+        auto changePercent = (baselineMedian > 0)
+                ? (((currentMedian - baselineMedian) / baselineMedian) * 100.0) : 0.0;
+        auto pValue = Utils::mannWhitneyPValue(baselineResult->second, currentResult.second);
+        auto isSignificant = (pValue < _benchSignificance);
+
+        // Classify the change (regressions fail the comparison)
+        std::string status = "UNCHANGED";
+        if (isSignificant && (changePercent > _benchRegressionThreshold))
+        {
+            status = "REGRESSED";
+            retFlag = false;
+        }
+        else if (isSignificant && (changePercent < -_benchRegressionThreshold))
+            status = "IMPROVED";
+
+        // Print-out the comparison for the benchmark
+        std::cout << "    " << std::left << std::setw(40) << currentResult.first << std::right
+                << std::fixed << std::setprecision(2) << std::setw(14) << baselineMedian << " -> "
+                << std::setw(14) << currentMedian << " ns/op " << std::showpos << std::setw(9)
+                << changePercent << "%" << std::noshowpos << std::setprecision(4) << " (p=" << pValue
+                << ") " << status << std::defaultfloat << std::endl;
+    }
+
+    // Report the overall comparison result
+    if (!retFlag)
+        std::cout << "Benchmarks regressed against baseline \"" << baseline << "\"" << std::endl;
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to get the headers to precompile, being the
+ * configured headers followed by the most-included external headers
+ * NOTE: Only unconditional includes of the project (non-test) files are counted
+ *
+ * @return Vector of Strings representing the headers to precompile
+ */
+std::vector<std::string> CMakeSettings::getPrecompiledHeaders()
+{
+
+    // Start with the explicitly configured headers
+    // NOTE: Plain paths are resolved through the include directories
+    std::vector<std::string> retVector;
+    for (const auto& header : _precompiledHeaders)
+    {
+        if ((header.front() == '<') || (header.front() == '"'))
+            retVector.push_back(header);
+        else
+            retVector.push_back("<" + header + ">");
+    }
+
+    // Only continue with auto-detection if it is enabled
+    if (_precompiledHeadersLimit > 0)
+    {
+
+        // Gather all of the (non-test) files that will be compiled as part of the project
+        std::vector<std::string> projectFiles;
+        for (const auto& item : _sourceFiles)
+            projectFiles.push_back(item.first);
+        for (const auto& item : _headerFiles)
+            projectFiles.push_back(item.first);
+        if (!_mainFile.empty())
+            projectFiles.push_back(_mainFile);
+
+        // Count the number of files including each angle-bracket header
+        std::map<std::string, unsigned int> includeCounts;
+        for (const auto& projectFile : projectFiles)
+        {
+
+            // Collect the unique unconditional includes for the current file
+            // NOTE: Includes within "#if" blocks (other than the include guard) are
+            //       skipped as they are typically platform or configuration specific
+            std::map<std::string, bool> fileIncludes;
+            std::ifstream fileStream(projectFile);
+            std::string line;
+            std::string guardMacro;
+            unsigned int conditionalDepth = 0;
+            unsigned int guardDepth = 0;
+            while (std::getline(fileStream, line))
+            {
+
+                // Only handle preprocessor directive lines
+                auto pos = line.find_first_not_of(" \t");
+                if ((pos == std::string::npos) || (line[pos] != '#'))
+                    continue;
+                pos = line.find_first_not_of(" \t", pos + 1);
+                if (pos == std::string::npos)
+                    continue;
+                auto endPos = line.find_first_of(" \t(<\"", pos);
+                auto directive = line.substr(pos, endPos - pos);
+                auto argument = ((endPos == std::string::npos) ? "" : line.substr(endPos));
+                Utils::trim(argument);
+
+                // Track the conditional blocks (detecting the "#ifndef X"/"#define X" include guard)
+                auto pendingGuard = guardMacro;
+                guardMacro.clear();
+                if ((directive == "if") || (directive == "ifdef") || (directive == "ifndef"))
+                {
+                    if ((directive == "ifndef") && (conditionalDepth == 0))
+                        guardMacro = argument;
+                    conditionalDepth++;
+                }
+                else if ((directive == "endif") && (conditionalDepth > 0))
+                {
+                    conditionalDepth--;
+                    if (conditionalDepth < guardDepth)
+                        guardDepth = 0;
+                }
+                else if ((directive == "define") && !pendingGuard.empty() && (argument == pendingGuard))
+                    guardDepth = conditionalDepth;
+
+                // Only handle unconditional lines of the form "#include <header>"
+                if ((directive != "include") || (conditionalDepth > guardDepth))
+                    continue;
+                pos = line.find_first_not_of(" \t", pos + 7);
+                if ((pos == std::string::npos) || (line[pos] != '<'))
+                    continue;
+                endPos = line.find('>', pos);
+                if (endPos != std::string::npos)
+                    fileIncludes[line.substr(pos + 1, endPos - pos - 1)] = true;
+            }
+            for (const auto& item : fileIncludes)
+                includeCounts[item.first]++;
+        }
+
+        // Filter-out Catch2 (handled separately for tests), project headers (which
+        // change too often to be worth precompiling) and single-use headers
+        std::vector<std::pair<std::string, unsigned int>> candidates;
+        for (const auto& item : includeCounts)
+        {
+            bool isProjectHeader = (item.first == "catch.hpp");
+            for (const auto& header : _headerFiles)
+            {
+                auto suffix = "/" + item.first;
+                if ((header.first.size() >= suffix.size())
+                        && (header.first.compare(header.first.size() - suffix.size(), suffix.size(), suffix) == 0))
+                    isProjectHeader = true;
+            }
+            if (!isProjectHeader && (item.second >= 2))
+                candidates.emplace_back(item.first, item.second);
+        }
+
+        // Take the most-included headers (ties are broken by name to keep the output stable)
+        std::stable_sort(candidates.begin(), candidates.end(),
+                [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+        for (size_t ii = 0; (ii < candidates.size()) && (ii < _precompiledHeadersLimit); ii++)
+        {
+            auto header = "<" + candidates[ii].first + ">";
+            if (std::find(retVector.begin(), retVector.end(), header) == retVector.end())
+                retVector.push_back(header);
+        }
+    }
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Internal function used to get the testing files split into shards
+ * NOTE: Shards are contiguous (path-ordered) ranges balanced by file size
+ *
+ * @return Vector of Vectors of Strings representing the shards' testing files
+ */
+std::vector<std::vector<std::string>> CMakeSettings::getTestShards()
+{
+
+    // Collect the testing files (and their sizes) in a stable order
+    std::vector<std::string> testFiles;
+    for (const auto& item : _testFiles)
+        testFiles.push_back(item.first);
+    std::sort(testFiles.begin(), testFiles.end());
+    std::vector<size_t> testFileSizes;
+    size_t totalSize = 0;
+    for (const auto& testFile : testFiles)
+    {
+        std::ifstream fileStream(testFile, std::ios::binary | std::ios::ate);
+        auto fileSize = fileStream.good() ? static_cast<size_t>(fileStream.tellg()) : 0;
+        testFileSizes.push_back(fileSize);
+        totalSize += fileSize;
+    }
+
+    // Determine the number of shards to use (automatically based on size if not set)
+    size_t shardCount = _testShards;
+    if (shardCount == 0)
+        shardCount = std::min<size_t>(16, (totalSize / (64 * 1024)) + 1);
+    shardCount = std::max<size_t>(1, std::min(shardCount, testFiles.size()));
+
+    // Assign each file to a shard based on where its mid-point falls
+    std::vector<std::vector<std::string>> shards(shardCount);
+    size_t runningSize = 0;
+    for (size_t ii = 0; ii < testFiles.size(); ii++)
+    {
+        size_t shardIndex = (ii * shardCount) / testFiles.size();
+        if (totalSize > 0)
+            shardIndex = ((runningSize + (testFileSizes[ii] / 2)) * shardCount) / totalSize;
+        shards[std::min(shardIndex, shardCount - 1)].push_back(testFiles[ii]);
+        runningSize += testFileSizes[ii];
+    }
+
+    // Remove any empty shards before returning
+    shards.erase(std::remove_if(shards.begin(), shards.end(),
+            [](const auto& shard) { return shard.empty(); }), shards.end());
+
+    // Return the shards
+    return shards;
+}
+
+/**
+ * Internal function used to move a freshly written (".tmp") generated file in
+ * to place only if its contents changed, preserving the timestamps otherwise
+ *
+ * @param filePath String representing the path to the generated file
+ * @return Boolean indicating if the operation was successful or not
+ */
+bool CMakeSettings::updateGeneratedFile(const std::string& filePath)
+{
+
+    // Replace the file only if the contents differ to avoid needless re-builds
+    return HiggsBoson::RunTypeSingleton::executeInContainer("cmp -s " + filePath + ".tmp " + filePath
+            + " && rm -f " + filePath + ".tmp || mv -f " + filePath + ".tmp " + filePath);
+}
 
-            // Write-in the CMake Higgs-Boson variables
-            cMakeFile.writeLine("# Higgs Build Variables");
-            cMakeFile.writeLine("set(HIGGS_PROJECT_NAME \"" + _projectName + "\")");
-            cMakeFile.writeLine("set(HIGGS_PROJECT_SRC \"" + _cMakeBuildDir + "\")");
-            cMakeFile.writeLine("set(HIGGS_PROJECT_CACHE \"" + _cMakeCacheDir + "\")");
-            cMakeFile.writeLine("set(HIGGS_PROJECT_VERSION \"" + _projectVersion + "\")");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to get the configure step for a persistent build tree,
+ * only re-running CMake (from a fresh cache) when the configuration changed
+ * NOTE: Changes to the generated CMake files themselves are picked-up by Make
+ *
+ * @param configureCommand String representing the CMake configure command
+ * @return String representing the (multi-line) shell configure step
+ */
+std::string CMakeSettings::getConfigureStep(const std::string& configureCommand)
+{
 
-            // Write-in the CMake Project details
-            cMakeFile.writeLine("# Project Specifics");
-            cMakeFile.writeLine("set(PROJECTNAME \"${HIGGS_PROJECT_NAME}\")");
-            cMakeFile.writeLine("project(${PROJECTNAME} CXX)");
-            cMakeFile.writeLine("");
+    // Stamp the configuration with the command and the toolchain environment
+    std::string configureStamp = Utils::sha256(configureCommand) + " $CC $CXX";
 
-            // Write-in the CMake Project targets
-            cMakeFile.writeLine("# Project Main Targets");
-            cMakeFile.writeLine("set(PROJECT_TARGET_MAIN \"${PROJECTNAME}\")");
-            cMakeFile.writeLine("set(PROJECT_TARGET_TEST \"${PROJECTNAME}_test\")");
-            cMakeFile.writeLine("");
+    // Setup the configure step to run only for new or changed configurations
+    std::string configureStep;
+    configureStep += "if [ ! -f CMakeCache.txt ] || [ \"$(cat higgs-configure.stamp 2> /dev/null)\" != \"" + configureStamp + "\" ]; then\n";
+    configureStep += "    rm -f CMakeCache.txt higgs-configure.stamp\n";
+    configureStep += "    " + configureCommand + "\n";
+    configureStep += "    echo \"" + configureStamp + "\" > higgs-configure.stamp\n";
+    configureStep += "fi";
 
-            // Write-in the CMake Project outputs
-            cMakeFile.writeLine("# Project Outputs");
-            cMakeFile.writeLine("set(CMAKE_ARCHIVE_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/lib)");
-            cMakeFile.writeLine("set(CMAKE_LIBRARY_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/lib)");
-            cMakeFile.writeLine("set(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR}/bin)");
-            cMakeFile.writeLine("");
+    // Return the configure step
+    return configureStep;
+}
 
-            // Write-in the CMake
-            cMakeFile.writeLine("# Setup the project version");
-            cMakeFile.writeLine("set(VERSION \"${HIGGS_PROJECT_VERSION}\")");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to get the CMake configure definitions for the
+ * given (per-target profile) custom compile and link flags
+ *
+ * @param compileFlags Vector of Strings representing the compile flags
+ * @param linkFlags Vector of Strings representing the link flags
+ * @return String representing the (quoted) CMake definitions (if any)
+ */
+std::string CMakeSettings::getFlagsDefinitions(const std::vector<std::string>& compileFlags,
+        const std::vector<std::string>& linkFlags)
+{
 
-            // Setup toolchain CMAKE variables based on environment variables (if present)
-            cMakeFile.writeLine("# Setup toolchain CMAKE variables based on environment variables (if present)");
-            cMakeFile.writeLine("if(DEFINED ENV{CC})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"C Compiler Set To: $ENV{CC}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{CXX})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"C++ Compiler Set To: $ENV{CXX}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{CPP})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"CPP Compiler Set To: $ENV{CPP}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{AS})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Assembler Set To: $ENV{AS}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{AR})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Archiver Set To: $ENV{AR}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{LD})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Linker Set To: $ENV{LD}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{FC})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Fortran Compiler Set To: $ENV{FC}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+    // Create a return string
+    std::string retString;
 
-            // Setup CMake cross-platform toolchain settings
-            cMakeFile.writeLine("# Setup CMake cross-platform toolchain settings");
-            cMakeFile.writeLine("set(CMAKE_CXX_COMPILER \"$ENV{CXX}\")");
-            cMakeFile.writeLine("set(CMAKE_C_COMPILER \"$ENV{CC}\")");
-            cMakeFile.writeLine("set(CMAKE_ASM_COMPILER \"$ENV{AS}\")");
-            cMakeFile.writeLine("set(CMAKE_Fortran_COMPILER $ENV{FC})");
-            cMakeFile.writeLine("if(DEFINED ENV{LD})");
-            cMakeFile.writeLine("    set(CMAKE_SYSTEM_VERSION 1)");
-            cMakeFile.writeLine("    set(CMAKE_SYSROOT \"$ENV{HIGGS_BOSON_SYSROOT}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+    // Add-in the (semicolon-separated) compile and link flags definitions
+    for (const auto& flags : {std::make_pair(std::string("HIGGS_COMPILE_FLAGS"), compileFlags),
+            std::make_pair(std::string("HIGGS_LINK_FLAGS"), linkFlags)})
+    {
+        if (!flags.second.empty())
+        {
+            retString += " '-D" + flags.first + "=";
+            for (size_t flagIndex = 0; flagIndex < flags.second.size(); flagIndex++)
+                retString += (flagIndex > 0 ? ";" : "") + flags.second[flagIndex];
+            retString += "'";
+        }
+    }
 
-            // Setup default environment variables for cross-building
-            // TODO - Inject default value based on target OS for higgs-boson project itself
-            cMakeFile.writeLine("# Setup default environment variables for cross-building");
-            cMakeFile.writeLine("if(DEFINED ENV{HIGGS_BOSON_TARGET_OS})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Target OS Set To: $ENV{HIGGS_BOSON_TARGET_OS}\")");
-            cMakeFile.writeLine("else()");
-            cMakeFile.writeLine("    set(ENV{HIGGS_BOSON_TARGET_OS} linux)");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Target OS Set To: $ENV{HIGGS_BOSON_TARGET_OS}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{HIGGS_BOSON_TARGET_PLATFORM})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Platform Set To: $ENV{HIGGS_BOSON_TARGET_PLATFORM}\")");
-            cMakeFile.writeLine("else()");
-            cMakeFile.writeLine("    set(ENV{HIGGS_BOSON_TARGET_PLATFORM} linux-clang)");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Platform Set To: $ENV{HIGGS_BOSON_TARGET_PLATFORM}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(DEFINED ENV{HIGGS_BOSON_TARGET_ARCH})");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Architecture Set To: $ENV{HIGGS_BOSON_TARGET_ARCH}\")");
-            cMakeFile.writeLine("else()");
-            cMakeFile.writeLine("    set(ENV{HIGGS_BOSON_TARGET_ARCH} x86_64)");
-            cMakeFile.writeLine("    MESSAGE(STATUS \"Target Architecture Set To: $ENV{HIGGS_BOSON_TARGET_ARCH}\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+    // Return the return string
+    return retString;
+}
 
-            // Ensure the base-compiler variables are setup for local builds
-            cMakeFile.writeLine("# Ensure the base-compiler variables are setup for local builds");
-            cMakeFile.writeLine("if(NOT DEFINED CMAKE_C_COMPILER)");
-            cMakeFile.writeLine("    set(CMAKE_C_COMPILER /usr/bin/clang)");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("if(NOT DEFINED CMAKE_CXX_COMPILER)");
-            cMakeFile.writeLine("    set(CMAKE_CXX_COMPILER /usr/bin/clang++)");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to get the perf availability and (non-root) event
+ * access step, lowering the perf_event_paranoid level only when needed
+ *
+ * @param perfEventParanoid String representing the highest usable paranoid level
+ * @return String representing the (multi-line) shell perf access step
+ */
+std::string CMakeSettings::getPerfAccessStep(const std::string& perfEventParanoid)
+{
 
-            // Specify pre-processor macros for the current platform being built
-            cMakeFile.writeLine("# Specify pre-processor macros for the current platform being built");
-            cMakeFile.writeLine("add_compile_definitions(HIGGS_BOSON_TARGET_OS=$ENV{HIGGS_BOSON_TARGET_OS})");
-            cMakeFile.writeLine("add_compile_definitions(HIGGS_BOSON_TARGET_PLATFORM=$ENV{HIGGS_BOSON_TARGET_PLATFORM})");
-            cMakeFile.writeLine("add_compile_definitions(HIGGS_BOSON_TARGET_ARCH=$ENV{HIGGS_BOSON_TARGET_ARCH})");
-            cMakeFile.writeLine("");
+    // Setup the perf availability check
+    std::string perfAccessStep;
+    perfAccessStep += "if ! perf --version > /dev/null 2>&1; then\n";
+    perfAccessStep += "    echo \"perf was not found in the builder container (install linux-tools)\"\n";
+    perfAccessStep += "    exit 1\n";
+    perfAccessStep += "fi\n";
+
+    // Setup the perf event access (failing if it could not be lowered far enough)
+    perfAccessStep += getKernelSettingStep("perf_event_paranoid", "-gt", perfEventParanoid) + "\n";
+    perfAccessStep += "if [ \"$(cat /proc/sys/kernel/perf_event_paranoid)\" -gt " + perfEventParanoid + " ]; then\n";
+    perfAccessStep += "    echo \"perf_event_paranoid is $(cat /proc/sys/kernel/perf_event_paranoid) and could not be lowered"
+            " (run 'sysctl kernel.perf_event_paranoid=" + perfEventParanoid + "' on the docker host)\"\n";
+    perfAccessStep += "    exit 1\n";
+    perfAccessStep += "fi";
+
+    // Return the perf access step
+    return perfAccessStep;
+}
 
-            // Write-in cross-compilation configuration
-            cMakeFile.writeLine("# Set Cross-Compilation Target Information");
-            cMakeFile.writeLine("set(CMAKE_HOST_SYSTEM_NAME Linux)");
-            cMakeFile.writeLine("set(CMAKE_SYSTEM_NAME $ENV{HIGGS_BOSON_TARGET_OS})");
-            cMakeFile.writeLine("set(CMAKE_CROSSCOMPILING ON)");
-            cMakeFile.writeLine("");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to get the step changing the given kernel setting
+ * only when needed, restoring its previous value once the script exits
+ * NOTE: Kernel settings are not namespaced so they are shared with the host
+ *
+ * @param settingName String representing the kernel setting (ie. "perf_event_paranoid")
+ * @param comparison String representing the shell test comparison to change on
+ * @param value String representing the value to change the kernel setting to
+ * @return String representing the (multi-line) shell kernel setting step
+ */
+std::string CMakeSettings::getKernelSettingStep(const std::string& settingName,
+        const std::string& comparison, const std::string& value)
+{
 
-            // Write in specifics to darwin (macos) related builds
-            cMakeFile.writeLine("# Specify specifics to darwin (macos) related builds");
-            cMakeFile.writeLine("if (CMAKE_SYSTEM_NAME STREQUAL darwin)");
-            cMakeFile.writeLine("    set(CMAKE_MACOSX_RPATH \"OFF\")");
-            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_PREFIX \"lib\")");
-            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_SUFFIX \".dylib\")");
-            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_SONAME_C_FLAG \"-install_name \")");
-            cMakeFile.writeLine("    set(CMAKE_SHARED_LIBRARY_SONAME_CXX_FLAG \"-install_name \")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
-            cMakeFile.writeLine("");
+    // Setup the kernel setting change, remembering the previous value first
+    // NOTE: The newest values are restored first so the original value is applied last
+    std::string settingPath = "/proc/sys/kernel/" + settingName;
+    std::string kernelSettingStep;
+    kernelSettingStep += "if [ -f " + settingPath + " ] && [ \"$(cat " + settingPath + ")\" " + comparison + " " + value + " ]; then\n";
+    kernelSettingStep += "    HIGGS_KERNEL_RESTORE=\"kernel." + settingName + "=$(cat " + settingPath + ") ${HIGGS_KERNEL_RESTORE:-}\"\n";
+    kernelSettingStep += "    trap 'sudo -n sysctl -q -w $HIGGS_KERNEL_RESTORE > /dev/null 2>&1 || true' EXIT\n";
+    kernelSettingStep += "    sudo -n sysctl -q -w kernel." + settingName + "=" + value + " > /dev/null 2>&1 || true\n";
+    kernelSettingStep += "fi";
+
+    // Return the kernel setting step
+    return kernelSettingStep;
+}
 
-            // Write-in the CMake source directories
-            cMakeFile.writeLine("# Setup the hard-coded source directory");
-            cMakeFile.writeLine("set(CMAKE_SOURCE_DIR ${HIGGS_PROJECT_SRC})");
-            cMakeFile.writeLine("set(CMAKE_CURRENT_SOURCE_DIR ${HIGGS_PROJECT_SRC})");
-            cMakeFile.writeLine("");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to get the name (build directory) and the CMake
+ * variable (if any) used for the given test-type
+ *
+ * @param testType TestType representing the CMake test
+ * @return Pair of Strings representing the test-type's name and CMake variable
+ */
+std::pair<std::string, std::string> CMakeSettings::getTestTypeSettings(TestType testType)
+{
 
-            // Write-in the CMake external dependencies section
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("# Setup Internal (required) dependencies");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("");
+    // Determine the test-type string based on the provided enum
+    std::string testTypeString;
+    std::string testCMakeVarString;
+    switch (testType)
+    {
 
-            // Write-in support for plibsys to handle platform specific things
-            cMakeFile.writeLine("# Add plibsys specific build parameters");
-            cMakeFile.writeLine("set(CMAKE_BUILD_TYPE, \"Release\")");
-            cMakeFile.writeLine("set(PLIBSYS_BUILD_STATIC, \"OFF\")");
-            cMakeFile.writeLine("set(CMAKE_C_COMPILER_ID, \"GNU\")");
-            cMakeFile.writeLine("set(PLIBSYS_TARGET_OS, \"$ENV{HIGGS_BOSON_TARGET_OS}\")");
-            cMakeFile.writeLine("set(PLIBSYS_TARGET_PLATFORM, \"$ENV{HIGGS_BOSON_TARGET_PLATFORM}\")");
-            cMakeFile.writeLine("set(CMAKE_SYSTEM_PROCESSOR, \"$ENV{HIGGS_BOSON_TARGET_ARCH}\")");
-            //cMakeFile.writeLine("add_subdirectory (${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson)");
-            cMakeFile.writeLine("include (${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson/platforms/$ENV{HIGGS_BOSON_TARGET_PLATFORM}/platform.cmake)");
-            cMakeFile.writeLine("include (${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson/cmake/PlatformDetect.cmake)");
-            cMakeFile.writeLine("plibsys_detect_target_os ($ENV{HIGGS_BOSON_TARGET_PLATFORM})");
-            cMakeFile.writeLine("MESSAGE(STATUS \"Platform-Specific Compiler Flags: ${PLIBSYS_PLATFORM_LINK_LIBRARIES}\")");
-            cMakeFile.writeLine("");
-            cMakeFile.writeLine("");
+        // Handle the "COVERAGE" enumeration case
+        case COVERAGE:
+            testTypeString = "coverage";
+            testCMakeVarString = "-DCODE_COVERAGE=1";
+            break;
 
-            // Write-in the CMake external dependencies section
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("# Setup External dependencies");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("");
+        // Handle the "SANITIZE_ADDRESS" enumeration case
+        case SANITIZE_ADDRESS:
+            testTypeString = "address";
+            testCMakeVarString = "-DSANITIZE_ADDRESS=1";
+            break;
 
-            // Write-in the CMake External includes files
-            cMakeFile.writeLine("# Add the include directories");
-            cMakeFile.writeLine("set(HIGGS_EXTERNAL_INCLUDES");
-            cMakeFile.writeLine("    ${CMAKE_BINARY_DIR}");
-            cMakeFile.writeLine("    \"${HIGGS_PROJECT_CACHE}/external/raw/plibsyshiggsboson/src\"");
-            cMakeFile.writeLine("    \"${HIGGS_PROJECT_CACHE}/external/raw/catch2higgsboson/single_include/catch2\"");
-            for (const auto& item : _externalIncludes)
-                cMakeFile.writeLine("    \"" + item + "\"");
-            cMakeFile.writeLine(")");
-            cMakeFile.writeLine("");
+        // Handle the "SANITIZE_BEHAVIOR" enumeration case
+        case SANITIZE_BEHAVIOR:
+            testTypeString = "behavior";
+            testCMakeVarString = "-DSANITIZE_BEHAVIOR=1";
+            break;
 
-            // Write-in the CMake external libraries files
-            cMakeFile.writeLine("# Setup the library and linker information");
-            cMakeFile.writeLine("set(HIGGS_EXTERNAL_LIBS");
-            for (auto libIndex = _externalLibraries.size(); libIndex > 0; libIndex--)
-                cMakeFile.writeLine("    \"" + _externalLibraries[libIndex - 1] + "\"");
-            cMakeFile.writeLine(")");
-            cMakeFile.writeLine("");
+        // Handle the "SANITIZE_THREAD" enumeration case
+        case SANITIZE_THREAD:
+            testTypeString = "thread";
+            testCMakeVarString = "-DSANITIZE_THREAD=1";
+            break;
+
+        // Handle the "SANITIZE_LEAK" enumeration case
+        case SANITIZE_LEAK:
+            testTypeString = "leak";
+            testCMakeVarString = "-DSANITIZE_LEAK=1";
+            break;
+
+        // Handle the "PROFILE" enumeration case
+        case PROFILE:
+            testTypeString = "profile";
+            break;
+
+        // Handle the default case
+        default:
+            testTypeString = "test";
+    }
+
+    // Return the test-type's name and CMake variable
+    return std::make_pair(testTypeString, testCMakeVarString);
+}
+
+/**
+ * Internal function used to get the test-cases (within the test files) affected
+ * by the files changed against the given git base reference
+ * NOTE: Includes are resolved through the project's source, test, and external
+ *       include directories
+ *
+ * @param baseRef String representing the git base reference (ie. "origin/main")
+ * @param testNames Vector of Strings to fill with the affected test-case names
+ * @return Boolean indicating whether the changes could be determined (a valid base reference)
+ */
+bool CMakeSettings::getAffectedTestNames(const std::string& baseRef, std::vector<std::string>& testNames)
+{
+
+    // Only continue if the changed files could be determined
+    testNames.clear();
+    std::vector<std::string> changedFiles;
+    if (!Utils::getChangedFiles(_cMakeBuildDir, baseRef, changedFiles))
+        return false;
+
+    // Build the include graph of the test files
+    IncludeGraph includeGraph;
+    includeGraph.addIncludeDir(_sourceDir);
+    includeGraph.addIncludeDir(_testDir);
+    for (const auto& includeDir : _externalIncludes)
+        includeGraph.addIncludeDir(includeDir);
+    std::vector<std::string> testFiles;
+    for (const auto& item : _testFiles)
+        testFiles.push_back(item.first);
+
+    // Extract the test-case names from the affected test files
+    for (const auto& testFile : includeGraph.getAffectedFiles(testFiles, changedFiles))
+    {
+
+        // Read-in the whole test file
+        std::ifstream fileStream(testFile);
+        std::string fileContents((std::istreambuf_iterator<char>(fileStream)), std::istreambuf_iterator<char>());
+
+        // Find the test-case macros and read-in their (first string) name argument
+        // NOTE: Catch2 prefixes the names of scenarios with "Scenario: "
+        for (const std::string macroName : {"TEST_CASE", "TEST_CASE_METHOD", "SCENARIO"})
+        {
+            size_t pos = 0;
+            while ((pos = fileContents.find(macroName, pos)) != std::string::npos)
+            {
+
+                // Only handle the macro itself (not longer identifiers containing it)
+                auto macroPos = pos;
+                pos += macroName.size();
+                auto isIdentifier = [](char character)
+                        { return (std::isalnum(static_cast<unsigned char>(character)) || (character == '_')); };
+                if (((macroPos > 0) && isIdentifier(fileContents[macroPos - 1]))
+                        || ((pos < fileContents.size()) && isIdentifier(fileContents[pos])))
+                    continue;
+                auto openPos = fileContents.find_first_not_of(" \t\r\n", pos);
+                if ((openPos == std::string::npos) || (fileContents[openPos] != '('))
+                    continue;
+
+                // Read-in the (unescaped) name up to the closing quote
+                auto quotePos = fileContents.find_first_of("\")", openPos);
+                if ((quotePos == std::string::npos) || (fileContents[quotePos] != '"'))
+                    continue;
+                std::string name;
+                for (pos = quotePos + 1; (pos < fileContents.size()) && (fileContents[pos] != '"'); pos++)
+                {
+                    if ((fileContents[pos] == '\\') && ((pos + 1) < fileContents.size()))
+                        pos++;
+                    name += fileContents[pos];
+                }
+                testNames.push_back(((macroName == "SCENARIO") ? "Scenario: " : "") + name);
+            }
+        }
+    }
 
-            // Write-in the CMake LLVM coverage information
-            cMakeFile.writeLine("# Add/Setup llvm coverage if desired/available");
-            cMakeFile.writeLine("SET(LLVM_COV_PATH \"/usr/bin/llvm-cov\")");
-            cMakeFile.writeLine("if(CMAKE_BUILD_TYPE STREQUAL \"coverage\" OR CODE_COVERAGE)");
-            cMakeFile.writeLine("    if(\"${CMAKE_C_COMPILER_ID}\" MATCHES \"(Apple)?[Cc]lang\" OR \"${CMAKE_CXX_COMPILER_ID}\" MATCHES \"(Apple)?[Cc]lang\")");
-            cMakeFile.writeLine("        message(\"Building with llvm Code Coverage Tools\")");
-            cMakeFile.writeLine("        # Warning/Error messages");
-            cMakeFile.writeLine("        if(NOT LLVM_COV_PATH)");
-            cMakeFile.writeLine("            message(FATAL_ERROR \"llvm-cov not found! Aborting.\")");
-            cMakeFile.writeLine("        endif()");
-            cMakeFile.writeLine("        # set Flags");
-            cMakeFile.writeLine("        set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -fprofile-instr-generate -fcoverage-mapping\")");
-            cMakeFile.writeLine("        set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -fprofile-instr-generate -fcoverage-mapping\")");
-            cMakeFile.writeLine("    elseif(CMAKE_COMPILER_IS_GNUCXX)");
-            cMakeFile.writeLine("        message(\"Building with lcov Code Coverage Tools\")");
-            cMakeFile.writeLine("        # Warning/Error messages");
-            cMakeFile.writeLine("        if(NOT (CMAKE_BUILD_TYPE STREQUAL \"Debug\"))");
-            cMakeFile.writeLine("            message(WARNING \"Code coverage results with an optimized (non-Debug) build may be misleading\")");
-            cMakeFile.writeLine("        endif()");
-            cMakeFile.writeLine("        if(NOT LCOV_PATH)");
-            cMakeFile.writeLine("            message(FATAL_ERROR \"lcov not found! Aborting...\")");
-            cMakeFile.writeLine("        endif()");
-            cMakeFile.writeLine("        if(NOT GENHTML_PATH)");
-            cMakeFile.writeLine("            message(FATAL_ERROR \"genhtml not found! Aborting...\")");
-            cMakeFile.writeLine("        endif()");
-            cMakeFile.writeLine("        set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} --coverage -fprofile-arcs -ftest-coverage\")");
-            cMakeFile.writeLine("        set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} --coverage -fprofile-arcs -ftest-coverage\")");
-            cMakeFile.writeLine("    else()");
-            cMakeFile.writeLine("        message(FATAL_ERROR \"Code coverage requires Clang or GCC. Aborting.\")");
-            cMakeFile.writeLine("    endif()");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+    // If we get here, the affected test-cases were determined successfully
+    return true;
+}
 
-            // Write-in the CMake coverages flags
-            cMakeFile.writeLine("if(NOT CODE_COVERAGE)");
-            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -Wall\")");
-            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS}  -Wall\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to write-out the given test-cases as a Catch2
+ * test-specification (input) file, matching each name exactly
+ *
+ * @param specFilePath String representing the path to write the file to
+ * @param testNames Vector of Strings representing the test-case names
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CMakeSettings::writeTestSpecFile(const std::string& specFilePath, const std::vector<std::string>& testNames)
+{
 
-            // Write-in the CMake memory sanitizer flags
-            cMakeFile.writeLine("if(SANITIZE_MEMORY)");
-            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=memory -fsanitize-memory-track-origins -O1 -fno-optimize-sibling-calls -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=memory -fsanitize-memory-track-origins -O1 -fno-optimize-sibling-calls -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+    // Create a return flag
+    bool retFlag = false;
 
-            // Write-in the CMake address sanitizer flags
-            cMakeFile.writeLine("if(SANITIZE_ADDRESS)");
-            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=address -fno-omit-frame-pointer -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=address -fno-omit-frame-pointer -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+    // Write-out each test-case name on its own line
+    auto specFile = FileWriter(specFilePath);
+    if (specFile.isOpen())
+    {
 
-            // Write-in the CMake leak sanitizer flags
-            cMakeFile.writeLine("if(SANITIZE_LEAK)");
-            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=leak -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=leak -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+        // Write-in the names escaping the special test-spec characters so names match exactly
+        for (const auto& name : testNames)
+        {
+            std::string escapedName;
+            for (auto character : name)
+            {
+                if (std::string("\\,[]*~\"").find(character) != std::string::npos)
+                    escapedName += '\\';
+                escapedName += character;
+            }
+            specFile.writeLine(escapedName);
+        }
 
-            // Write-in the CMake thread sanitizer flags
-            cMakeFile.writeLine("if(SANITIZE_THREAD)");
-            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=thread -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=thread -O1 -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+        // Close the test-specification file
+        specFile.close();
 
-            // Write-in the CMake behavior sanitizer flags
-            cMakeFile.writeLine("if(SANITIZE_BEHAVIOR)");
-            cMakeFile.writeLine("    set(CMAKE_C_FLAGS \"${CMAKE_C_FLAGS} -g -fsanitize=undefined -fsanitize-minimal-runtime -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("    set(CMAKE_CXX_FLAGS \"${CMAKE_CXX_FLAGS} -g -fsanitize=undefined -fsanitize-minimal-runtime -fsanitize-blacklist=${HIGGS_PROJECT_CACHE}/sanitize-blacklist.txt\")");
-            cMakeFile.writeLine("endif()");
-            cMakeFile.writeLine("");
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
 
-            // Write-in the CMake R-path information
-            // TODO - Needs to be target-specific
-            //cMakeFile.writeLine("# Add in the higgs library linker location to the R-path");
-            //cMakeFile.writeLine("set(CMAKE_BUILD_RPATH \"/usr/lib/higgs-boson\")");
-            //cMakeFile.writeLine("set(CMAKE_INSTALL_RPATH  \"/usr/lib/higgs-boson\")");
-            //cMakeFile.writeLine("");
+    // Return the return flag
+    return retFlag;
+}
 
-            // Write-in the CMake main project target section
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("# Setup Target: Main Project");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to merge the (per-process) coverage profiles of
+ * a test run in parallel and report on the covered source files
+ * NOTE: The HTML report is written to "bin/llvm-coverage" in the build tree
+ *
+ * @param testBuildDir String representing the coverage build tree
+ * @param coverageBaseRef String representing the git base reference to limit the
+ *                        report to the changed files (if any)
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CMakeSettings::reportCoverage(const std::string& testBuildDir, const std::string& coverageBaseRef)
+{
 
-            // Write-in the CMake external includes details
-            cMakeFile.writeLine("# Setup the include directories");
-            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_MAIN} PUBLIC $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/src>)");
-            cMakeFile.writeLine("");
+    // Create a return flag
+    bool retFlag = false;
 
-            // Write-in the CMake include files
-            cMakeFile.writeLine("# Setup Headers");
-            cMakeFile.writeLine("set(${PROJECT_TARGET_MAIN}_headers");
-            for (const auto& item : _headerFiles)
-                cMakeFile.writeLine("        \"" + item.first + "\"");
-            cMakeFile.writeLine(")");
-            cMakeFile.writeLine("");
+    // Determine the source files to report on (only changed files against the base reference)
+    std::string sourceFiles = _sourceDir;
+    if (!coverageBaseRef.empty())
+    {
+        sourceFiles = "";
+        std::vector<std::string> changedFiles;
+        if (!Utils::getChangedFiles(_sourceDir, coverageBaseRef, changedFiles))
+        {
+            std::cout << "Unknown git base reference: " << coverageBaseRef << " (it must be a fetched commit)" << std::endl;
+            return retFlag;
+        }
+        std::vector<std::string> sourceExtensions = {".c", ".cc", ".cpp", ".cxx", ".h", ".hh", ".hpp", ".hxx", ".inl"};
+        for (const auto& changedFile : changedFiles)
+        {
+            auto extensionPos = changedFile.find_last_of('.');
+            if ((extensionPos != std::string::npos) && (std::find(sourceExtensions.begin(),
+                    sourceExtensions.end(), changedFile.substr(extensionPos)) != sourceExtensions.end()))
+                sourceFiles += (sourceFiles.empty() ? "" : " ") + changedFile;
+        }
+    }
 
-            // Write-in the CMake source files
-            cMakeFile.writeLine("# C++ Source Files");
-            cMakeFile.writeLine("set(${PROJECT_TARGET_MAIN}_sources");
-            for (const auto& item : _sourceFiles)
-                cMakeFile.writeLine("        \"" + item.first + "\"");
-            cMakeFile.writeLine(")");
-            cMakeFile.writeLine("");
+    // Write-out the coverage report shell file
+    std::string testBinary = testBuildDir + "/bin/" + _projectName + "_test";
+    std::string profileData = testBuildDir + "/" + _projectName + "_test.profdata";
+    auto reportShellFile = FileWriter(_cMakeCacheDir + "/builds/coverage.report.sh");
+    if (reportShellFile.isOpen())
+    {
 
-            // Write-in the CMake main project target information
-            cMakeFile.writeLine("# Create the actual library for main project");
-            if (mainSourceFile.empty())
-                cMakeFile.writeLine("add_library(${PROJECT_TARGET_MAIN} SHARED ");
-            else
-                cMakeFile.writeLine("add_executable(${PROJECT_TARGET_MAIN} " + mainSourceFile);
-            cMakeFile.writeLine("        ${${PROJECT_TARGET_MAIN}_sources} ${${PROJECT_TARGET_MAIN}_headers})");
-            //cMakeFile.writeLine("add_dependencies(${PROJECT_TARGET_MAIN} plibsys)");
-            //cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_MAIN} plibsys)");
-            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_MAIN} ${HIGGS_EXTERNAL_LIBS})");
-            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_MAIN} ${PLIBSYS_PLATFORM_LINK_LIBRARIES})");
-            cMakeFile.writeLine("");
+        // Write-in the standard Higgs-Boson header for the report file
+        reportShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        reportShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        reportShellFile.writeLine("set -e");
+        reportShellFile.writeLine("");
 
-            // Write-in the CMake target includes details
-            cMakeFile.writeLine("# Setup include directories for the main project");
-            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_MAIN} \"${HIGGS_EXTERNAL_INCLUDES}\")");
-            cMakeFile.writeLine("");
-            cMakeFile.writeLine("");
+        // Write-in the parallel merge of the per-process profiles
+        reportShellFile.writeLine("# Merge the per-process coverage profiles in parallel");
+        reportShellFile.writeLine("llvm-profdata merge -sparse -j $(nproc) " + testBuildDir
+                + "/profraw/*.profraw -o " + profileData);
+        reportShellFile.writeLine("");
 
-            // Write-in the CMake test target section
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("# Setup Target: Test Project");
-            cMakeFile.writeLine("#");
-            cMakeFile.writeLine("");
+        // Write-in the coverage report for the (changed) source files
+        if (sourceFiles.empty())
+        {
+            reportShellFile.writeLine("# No source files changed against the base reference");
+            reportShellFile.writeLine("echo \"No source files changed against " + coverageBaseRef + "\"");
+        }
+        else
+        {
+            reportShellFile.writeLine("# Report the coverage of the "
+                    + std::string(coverageBaseRef.empty() ? "source files" : ("source files changed against " + coverageBaseRef)));
+            reportShellFile.writeLine("llvm-cov report " + testBinary + " -instr-profile=" + profileData + " " + sourceFiles);
+            reportShellFile.writeLine("rm -rf " + testBuildDir + "/bin/llvm-coverage");
+            reportShellFile.writeLine("llvm-cov show " + testBinary + " -instr-profile=" + profileData
+                    + " -show-line-counts-or-regions -output-dir=" + testBuildDir + "/bin/llvm-coverage -format=\"html\" " + sourceFiles);
+            reportShellFile.writeLine("echo \"" + testBuildDir + "/bin/llvm-coverage/index.html in your browser to view the coverage report.\"");
+        }
+        reportShellFile.writeLine("");
 
-            // Write-in the CMake Catch-testing setup information
-            cMakeFile.writeLine("# Prepare \"Catch\" library for other executables");
-            cMakeFile.writeLine("set(TEST_INCLUDE_DIR ${CMAKE_CURRENT_SOURCE_DIR}/test)");
-            cMakeFile.writeLine("set(CATCH_INCLUDE_DIR ${CMAKE_CURRENT_SOURCE_DIR}/.higgs/external/raw/catch2higgsboson/single_include/catch2)");
-            cMakeFile.writeLine("add_library(Catch INTERFACE)");
-            cMakeFile.writeLine("target_include_directories(Catch INTERFACE ${CATCH_INCLUDE_DIR} ${TEST_INCLUDE_DIR})");
-            cMakeFile.writeLine("");
+        // Close the shell-file
+        reportShellFile.close();
 
-            // Write-in the CMake include directories for testing
-            cMakeFile.writeLine("# Setup the include directories for the test target");
-            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} PUBLIC $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/src>)");
-            cMakeFile.writeLine("");
+        // Run the coverage report
+        retFlag = HiggsBoson::RunTypeSingleton::executeInContainer(
+                "bash " + _cMakeCacheDir + "/builds/coverage.report.sh");
+    }
 
-            // Write-in the CMake test source files
-            cMakeFile.writeLine("# Setup test sources");
-            cMakeFile.writeLine("set(TEST_SOURCES");
-            for (const auto& item : _testFiles)
-                cMakeFile.writeLine("        \"" + item.first + "\"");
-            cMakeFile.writeLine(")");
-            cMakeFile.writeLine("");
+    // Return the return flag
+    return retFlag;
+}
 
-            // Write-in the CMake testing target
-            cMakeFile.writeLine("# Make the test executable");
-            cMakeFile.writeLine("add_executable(${PROJECT_TARGET_TEST} ${HIGGS_PROJECT_CACHE}/main.test.cpp ${TEST_SOURCES}");
-            cMakeFile.writeLine("        ${${PROJECT_TARGET_MAIN}_sources} ${${PROJECT_TARGET_MAIN}_headers})");
-            cMakeFile.writeLine("");
+/**
+ * Internal function used to run the built tests split across concurrent
+ * processes, balanced using the historical per-test durations
+ *
+ * @param testTypeString String representing the test-type (build directory) name
+ * @param testFilter String representing the test filter to apply
+ * @param parallelJobs Unsigned Integer representing the number of concurrent processes
+ * @param libraryLdPathString String representing the library path (and environment) variables to run with
+ * @return Boolean indicating whether the operation (and all tests) were successful
+ */
+bool CMakeSettings::runTestsInParallel(const std::string& testTypeString,
+        const std::string& testFilter, unsigned int parallelJobs,
+        const std::string& libraryLdPathString)
+{
 
-            // Write-in the CMake include source/headers for testing targets
-            cMakeFile.writeLine("# Setup include directories for the test project");
-            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} \"${CMAKE_SOURCE_DIR}/src\")");
-            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} \"${CMAKE_SOURCE_DIR}/test\")");
-            cMakeFile.writeLine("include_directories(${PROJECT_TARGET_TEST} \"${HIGGS_EXTERNAL_INCLUDES}\")");
-            cMakeFile.writeLine("");
+    // Create a return flag
+    bool retFlag = false;
 
-            // Write-in the CMake testing target libraries information
-            cMakeFile.writeLine("# Setup the test target");
-            //cMakeFile.writeLine("add_dependencies(${PROJECT_TARGET_TEST} plibsys)");
-            //cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} plibsys)");
-            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} ${HIGGS_EXTERNAL_LIBS})");
-            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} ${PLIBSYS_PLATFORM_LINK_LIBRARIES})");
-            cMakeFile.writeLine("target_link_libraries(${PROJECT_TARGET_TEST} Catch)");
-            cMakeFile.writeLine("");
+    // Setup the paths used for the parallel test run
+    std::string testBinary = _cMakeCacheDir + "/builds/" + testTypeString + "/bin/" + _projectName + "_test";
+    std::string parallelDir = _cMakeCacheDir + "/builds/" + testTypeString + "-parallel";
+    std::string durationsFile = _cMakeCacheDir + "/builds/" + testTypeString + ".durations.tsv";
+    HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + parallelDir + " && mkdir -p " + parallelDir);
+
+    // Write-out and run the test listing file to enumerate the test-cases
+    auto listShellFile = FileWriter(_cMakeCacheDir + "/builds/" + testTypeString + ".list.sh");
+    if (!listShellFile.isOpen())
+        return retFlag;
+    listShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+    listShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+    listShellFile.writeLine("");
+    listShellFile.writeLine("# List the test-cases matching the filter");
+    listShellFile.writeLine("# NOTE: Catch2 returns the number of listed tests as the exit code");
+    listShellFile.writeLine(libraryLdPathString + " " + testBinary + " " + testFilter
+            + " --list-test-names-only > " + parallelDir + "/tests.txt || true");
+    listShellFile.close();
+    if (!HiggsBoson::RunTypeSingleton::executeInContainer("bash " + _cMakeCacheDir
+            + "/builds/" + testTypeString + ".list.sh"))
+        return retFlag;
+
+    // Read-in the listed test-cases
+    std::vector<std::string> testNames;
+    std::ifstream testsStream(parallelDir + "/tests.txt");
+    std::string testName;
+    while (std::getline(testsStream, testName))
+        if (!Utils::trim(testName).empty())
+            testNames.push_back(testName);
+
+    // Read-in the historical test durations (seconds, tab, test-name)
+    std::map<std::string, double> durations;
+    std::ifstream durationsStream(durationsFile);
+    std::string durationLine;
+    while (std::getline(durationsStream, durationLine))
+    {
+        auto tabPos = durationLine.find('\t');
+        if (tabPos != std::string::npos)
+            durations[durationLine.substr(tabPos + 1)] = std::atof(durationLine.substr(0, tabPos).c_str());
+    }
 
-            // Write-in the CMake testing compile definitions
-            cMakeFile.writeLine("# Setup Testing definitions");
-            cMakeFile.writeLine("target_compile_definitions(${PROJECT_TARGET_TEST} PRIVATE CATCH_TESTING=1)");
-            cMakeFile.writeLine("");
+    // Weight each test-case by its duration (unknown tests use the known average)
+    double knownDurations = 0;
+    size_t knownCount = 0;
+    for (const auto& name : testNames)
+        if (durations.find(name) != durations.end())
+        {
+            knownDurations += durations[name];
+            knownCount++;
+        }
+    double defaultDuration = ((knownCount > 0) ? (knownDurations / knownCount) : 1.0);
+    std::vector<std::pair<double, std::string>> weightedTests;
+    for (const auto& name : testNames)
+        weightedTests.emplace_back((durations.find(name) != durations.end()) ? durations[name] : defaultDuration, name);
+    std::stable_sort(weightedTests.begin(), weightedTests.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    // Balance the test-cases across the shards (longest-first onto the least-loaded shard)
+    size_t shardCount = std::max<size_t>(1, std::min<size_t>(parallelJobs, testNames.size()));
+    std::vector<std::vector<std::string>> shards(shardCount);
+    std::vector<double> shardLoads(shardCount, 0);
+    for (const auto& weightedTest : weightedTests)
+    {
+        auto shardIndex = std::min_element(shardLoads.begin(), shardLoads.end()) - shardLoads.begin();
+        shards[shardIndex].push_back(weightedTest.second);
+        shardLoads[shardIndex] += weightedTest.first;
+    }
 
-            // Write-in the CMake testing LLVM coverage information
-            cMakeFile.writeLine("# Setup the LLVM Coverage Target");
-            cMakeFile.writeLine("add_custom_target(${PROJECT_TARGET_TEST}_coverage");
-            cMakeFile.writeLine("        COMMAND LLVM_PROFILE_FILE=${PROJECT_TARGET_TEST}.profraw $<TARGET_FILE:${PROJECT_TARGET_TEST}>");
-            cMakeFile.writeLine("        COMMAND llvm-profdata merge -sparse ${PROJECT_TARGET_TEST}.profraw -o ${PROJECT_TARGET_TEST}.profdata");
-            cMakeFile.writeLine("        COMMAND llvm-cov report $<TARGET_FILE:${PROJECT_TARGET_TEST}> -instr-profile=${PROJECT_TARGET_TEST}.profdata ${CMAKE_SOURCE_DIR}/src");
-            cMakeFile.writeLine("        COMMAND llvm-cov show $<TARGET_FILE:${PROJECT_TARGET_TEST}> -instr-profile=${PROJECT_TARGET_TEST}.profdata -show-line-counts-or-regions -output-dir=${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/llvm-coverage -format=\"html\" ${CMAKE_SOURCE_DIR}/src");
-            cMakeFile.writeLine("        COMMAND echo \"${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/llvm-coverage/index.html in your browser to view the coverage report.\"");
-            cMakeFile.writeLine(")");
+    // Write-out the test-specification (input) file for each shard
+    for (size_t shardIndex = 0; shardIndex < shardCount; shardIndex++)
+    {
+        std::string shardDir = parallelDir + "/shard-" + std::to_string(shardIndex);
+        HiggsBoson::RunTypeSingleton::executeInContainer("mkdir -p " + shardDir);
+        if (!writeTestSpecFile(shardDir + "/tests.txt", shards[shardIndex]))
+            return retFlag;
+    }
 
-            // Close the CMake file
-            cMakeFile.close();
+    // Write-out the parallel test shell file
+    auto parallelShellFile = FileWriter(_cMakeCacheDir + "/builds/" + testTypeString + ".parallel.sh");
+    if (parallelShellFile.isOpen())
+    {
 
-            // If we get here, mark the operation as successful
-            retFlag = true;
+        // Write-in the standard Higgs-Boson header for the parallel test file
+        parallelShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        parallelShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        parallelShellFile.writeLine("");
+
+        // Write-in the concurrent shard runs (each isolating its outputs in its own directory)
+        // NOTE: The working directory is left as-is so tests see the same relative paths
+        //       as when they are run serially
+        parallelShellFile.writeLine("# Run the test shards concurrently: " + testTypeString);
+        for (size_t shardIndex = 0; shardIndex < shardCount; shardIndex++)
+        {
+            std::string shardDir = parallelDir + "/shard-" + std::to_string(shardIndex);
+            parallelShellFile.writeLine("(TMPDIR=" + shardDir + " HIGGS_BOSON_TEST_SHARD=" + std::to_string(shardIndex)
+                    + " " + libraryLdPathString + " " + testBinary + " -f " + shardDir + "/tests.txt -r junit -o "
+                    + shardDir + "/results.xml > " + shardDir + "/output.log 2>&1;"
+                    + " echo $? > " + shardDir + "/status) &");
         }
+        parallelShellFile.writeLine("wait");
+        parallelShellFile.writeLine("");
+
+        // Write-in the merging of the shard results into a single JUnit report
+        parallelShellFile.writeLine("# Merge the shard results into a single JUnit report");
+        parallelShellFile.writeLine("echo '<?xml version=\"1.0\" encoding=\"UTF-8\"?>' > " + parallelDir + "/results.xml");
+        parallelShellFile.writeLine("echo '<testsuites>' >> " + parallelDir + "/results.xml");
+        parallelShellFile.writeLine("for shardDir in " + parallelDir + "/shard-*; do");
+        parallelShellFile.writeLine("    sed -n '/<testsuite /,/<\\/testsuite>/p' $shardDir/results.xml >> " + parallelDir + "/results.xml");
+        parallelShellFile.writeLine("done");
+        parallelShellFile.writeLine("echo '</testsuites>' >> " + parallelDir + "/results.xml");
+        parallelShellFile.writeLine("");
+
+        // Write-in the aggregation of the shard exit statuses
+        parallelShellFile.writeLine("# Aggregate the shard exit statuses (printing the output of failed shards)");
+        parallelShellFile.writeLine("status=0");
+        parallelShellFile.writeLine("for shardDir in " + parallelDir + "/shard-*; do");
+        parallelShellFile.writeLine("    if [ \"$(cat $shardDir/status)\" != \"0\" ]; then");
+        parallelShellFile.writeLine("        echo \"Test $(basename $shardDir) failed:\"");
+        parallelShellFile.writeLine("        sed -n '/<testcase .*[^/]>$/,/<\\/testcase>/p' $shardDir/results.xml");
+        parallelShellFile.writeLine("        cat $shardDir/output.log");
+        parallelShellFile.writeLine("        status=1");
+        parallelShellFile.writeLine("    fi");
+        parallelShellFile.writeLine("done");
+        parallelShellFile.writeLine("");
+
+        // Write-in the post-test commands
+        parallelShellFile.writeLine("# Post-Test commands for the Test");
+        for (const auto& postTestCmd : _postTestCommands)
+            parallelShellFile.writeLine(postTestCmd);
+        parallelShellFile.writeLine("");
+        parallelShellFile.writeLine("exit $status");
+
+        // Close the shell-file
+        parallelShellFile.close();
+
+        // Run the parallel tests and keep track of the results
+        std::cout << "Running " << testNames.size() << " Test Cases across " << shardCount << " Shards" << std::endl;
+        retFlag = HiggsBoson::RunTypeSingleton::executeInContainer(
+                "bash " + _cMakeCacheDir + "/builds/" + testTypeString + ".parallel.sh");
+    }
+
+    // Read-in the merged results to update the per-test durations
+    // NOTE: Sections are reported as "<test-case>/<section>" and are summed per test-case
+    std::ifstream resultsStream(parallelDir + "/results.xml");
+    std::string resultsLine;
+    size_t testCaseCount = 0;
+    size_t failureCount = 0;
+    std::map<std::string, double> newDurations;
+    while (std::getline(resultsStream, resultsLine))
+    {
+
+        // Count the failures in the results
+        if ((resultsLine.find("<failure") != std::string::npos) || (resultsLine.find("<error") != std::string::npos))
+            failureCount++;
+
+        // Only continue for test-case entries
+        auto namePos = resultsLine.find(" name=\"");
+        auto timePos = resultsLine.find(" time=\"");
+        if ((resultsLine.find("<testcase ") == std::string::npos)
+                || (namePos == std::string::npos) || (timePos == std::string::npos))
+            continue;
+        testCaseCount++;
+
+        // Extract (and un-escape) the test-case name and its duration
+        std::string name = resultsLine.substr(namePos + 7, resultsLine.find('"', namePos + 7) - namePos - 7);
+        for (const auto& entity : std::vector<std::pair<std::string, std::string>>{{"&lt;", "<"},
+                {"&gt;", ">"}, {"&quot;", "\""}, {"&apos;", "'"}, {"&amp;", "&"}})
+            for (auto pos = name.find(entity.first); pos != std::string::npos; pos = name.find(entity.first, pos + 1))
+                name.replace(pos, entity.first.size(), entity.second);
+        double duration = std::atof(resultsLine.substr(timePos + 7).c_str());
+
+        // Attribute the duration to the (longest) matching listed test-case
+        std::string owningTest;
+        for (const auto& listedName : testNames)
+            if (((name == listedName) || (name.rfind(listedName + "/", 0) == 0))
+                    && (listedName.size() > owningTest.size()))
+                owningTest = listedName;
+        if (!owningTest.empty())
+            newDurations[owningTest] += duration;
+    }
+
+    // Write-out the updated durations for the next run
+    for (const auto& item : newDurations)
+        durations[item.first] = item.second;
+    auto durationsShellFile = FileWriter(durationsFile);
+    if (durationsShellFile.isOpen())
+    {
+        for (const auto& item : durations)
+            durationsShellFile.writeLine(std::to_string(item.second) + "\t" + item.first);
+        durationsShellFile.close();
     }
 
+    // Print the summary of the parallel test run
+    std::cout << "Test Results: " << testCaseCount << " Results, " << failureCount << " Failures ("
+            << parallelDir << "/results.xml)" << std::endl;
+
     // Return the return flag
     return retFlag;
 }
+
+/**
+ * Internal function used to get a hash representing the current contents
+ * of the project's (non-testing) source files
+ *
+ * @return String representing the hash of the source files
+ */
+std::string CMakeSettings::getSourceHash()
+{
+
+    // Collect the project files in a stable (sorted) order
+    std::vector<std::string> projectFiles;
+    if (!_mainFile.empty())
+        projectFiles.push_back(_mainFile);
+    for (const auto& item : _sourceFiles)
+        projectFiles.push_back(item.first);
+    for (const auto& item : _headerFiles)
+        projectFiles.push_back(item.first);
+    std::sort(projectFiles.begin(), projectFiles.end());
+
+    // Concatenate the paths and contents of the files to hash
+    std::string hashData;
+    for (const auto& projectFile : projectFiles)
+    {
+        std::ifstream fileStream(projectFile);
+        hashData += projectFile + "\n";
+        hashData += std::string((std::istreambuf_iterator<char>(fileStream)),
+                std::istreambuf_iterator<char>()) + "\n";
+    }
+
+    // Return the hash of the collected data
+    return Utils::sha256(hashData);
+}
+
+/**
+ * Internal function used to get the path to the cached profile-guided
+ * optimization profile for the current project sources
+ * NOTE: The profile itself may not have been generated yet
+ *
+ * @return String representing the path to the profile
+ */
+std::string CMakeSettings::getOptimizationProfilePath()
+{
+
+    // Key the profile on the source hash so stale profiles are never used
+    return _cMakeCacheDir + "/pgo/" + getSourceHash() + ".profdata";
+}
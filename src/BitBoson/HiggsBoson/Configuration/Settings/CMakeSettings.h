@@ -22,6 +22,7 @@
 #ifndef HIGGS_BOSON_CMAKE_SETTINGS_H
 #define HIGGS_BOSON_CMAKE_SETTINGS_H
 
+#include <map>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -45,6 +46,13 @@ namespace BitBoson
                 SANITIZE_LEAK,
                 PROFILE
             };
+            enum ProfileType
+            {
+                SAMPLER,
+                OFF_CPU,
+                HEAP,
+                CACHE
+            };
 
         // Private member variables
         private:
@@ -54,15 +62,31 @@ namespace BitBoson
             std::string _projectVersion;
             std::string _cMakeBuildDir;
             std::string _cMakeCacheDir;
+            std::string _sourceDir;
+            std::string _testDir;
             std::vector<std::string> _preBuildCommands;
             std::vector<std::string> _postBuildCommands;
             std::vector<std::string> _preTestCommands;
             std::vector<std::string> _postTestCommands;
             std::vector<std::string> _externalLibraries;
             std::vector<std::string> _externalIncludes;
+            std::vector<std::string> _precompiledHeaders;
+            unsigned int _precompiledHeadersLimit;
+            unsigned int _testShards;
+            std::unordered_map<std::string, std::string> _ltoModes;
+            std::string _linker;
+            std::string _debugInfo;
+            std::unordered_map<std::string, std::unordered_map<std::string, std::string>> _profileBuildTypes;
+            std::unordered_map<std::string, std::unordered_map<std::string, std::vector<std::string>>> _profileCompileFlags;
+            std::unordered_map<std::string, std::unordered_map<std::string, std::vector<std::string>>> _profileLinkFlags;
+            std::string _pgoWorkloadType;
+            std::string _pgoWorkload;
+            double _benchRegressionThreshold;
+            double _benchSignificance;
             std::unordered_map<std::string, bool> _sourceFiles;
             std::unordered_map<std::string, bool> _headerFiles;
             std::unordered_map<std::string, bool> _testFiles;
+            std::unordered_map<std::string, bool> _benchmarkFiles;
 
         // Public member functions
         public:
@@ -87,6 +111,15 @@ namespace BitBoson
              */
             void setMainSource(const std::string& mainSource);
 
+            /**
+             * Function used to set the project's source and testing directories
+             * NOTE: These default to the "src" and "test" directories of the project
+             *
+             * @param sourceDir String representing the path to the source directory
+             * @param testDir String representing the path to the testing directory
+             */
+            void setProjectDirs(const std::string& sourceDir, const std::string& testDir);
+
             /**
              * Function used to add a source-file to the CMake configuration
              *
@@ -111,6 +144,14 @@ namespace BitBoson
              */
             bool addTestingFile(const std::string& testingFile);
 
+            /**
+             * Function used to add a benchmark-file to the CMake configuration
+             *
+             * @param benchmarkFile String representing the path to the benchmark file
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool addBenchmarkFile(const std::string& benchmarkFile);
+
             /**
              * Function used to add a pre-build command to the configuration
              *
@@ -153,22 +194,191 @@ namespace BitBoson
              */
             void addIncludeDir(const std::string& includesPath);
 
+            /**
+             * Function used to add a precompiled header to the configuration
+             *
+             * @param header String representing the header (<name> or path)
+             */
+            void addPrecompiledHeader(const std::string& header);
+
+            /**
+             * Function used to set the maximum number of auto-detected
+             * (most-included) headers to precompile for the configuration
+             * NOTE: A limit of zero (the default) disables the auto-detection
+             *
+             * @param limit Unsigned Integer representing the header limit
+             */
+            void setPrecompiledHeadersLimit(unsigned int limit);
+
+            /**
+             * Function used to set the number of test shards (translation units)
+             * to split the testing files across for the configuration
+             * NOTE: A shard count of zero sizes the shards automatically
+             *
+             * @param testShards Unsigned Integer representing the number of shards
+             */
+            void setTestShards(unsigned int testShards);
+
+            /**
+             * Function used to set the link-time optimization mode for a target
+             *
+             * @param target String representing the target to set the mode for
+             * @param ltoMode String representing the mode (off, thin, or full)
+             */
+            void setLinkTimeOptimization(const std::string& target, const std::string& ltoMode);
+
+            /**
+             * Function used to set the linker used for the configuration
+             * NOTE: Unavailable linkers fall back to the default linker
+             *
+             * @param linker String representing the linker (default, lld, mold, or gold)
+             */
+            void setLinker(const std::string& linker);
+
+            /**
+             * Function used to set how debug information is generated for the
+             * configuration (for the build-types which include debug information)
+             *
+             * @param debugInfo String representing the mode (full, split, compressed, or none)
+             */
+            void setDebugInfo(const std::string& debugInfo);
+
+            /**
+             * Function used to set the training workload used to generate the
+             * profile for profile-guided optimization
+             *
+             * @param workloadType String representing the workload type (run, test, or bench)
+             * @param workload String representing the command to run (run) or the
+             *                 test/benchmark filter to apply (test/bench)
+             */
+            void setOptimizationWorkload(const std::string& workloadType, const std::string& workload);
+
+            /**
+             * Function used to set the gate used when comparing benchmarks against a
+             * baseline, where a benchmark regresses if it is slower by more than the
+             * threshold with a (Mann-Whitney U) p-value below the significance level
+             *
+             * @param thresholdPercent Double representing the allowed slowdown (percent)
+             * @param significance Double representing the significance level (alpha)
+             */
+            void setBenchmarkRegressionGate(double thresholdPercent, double significance);
+
+            /**
+             * Function used to add a build profile (build-type and flags) for a target
+             *
+             * @param profile String representing the name of the build profile
+             * @param target String representing the target the profile applies to
+             * @param buildType String representing the CMake build-type to use
+             * @param compileFlags Vector of Strings representing the compile flags
+             * @param linkFlags Vector of Strings representing the link flags
+             */
+            void addBuildProfile(const std::string& profile, const std::string& target,
+                    const std::string& buildType, const std::vector<std::string>& compileFlags,
+                    const std::vector<std::string>& linkFlags);
+
             /**
              * Function used to compile/build the CMake project for the target
              *
              * @param target String representing the target to compile for
+             * @param profile String representing the build profile to use (if any)
+             * @param timeTrace Boolean indicating whether to write per translation-unit time-traces
              * @return Boolean indicating whether the operation was successful
              */
-            bool buildCMakeProject(const std::string& target);
+            bool buildCMakeProject(const std::string& target, const std::string& profile="",
+                    bool timeTrace=false);
+
+            /**
+             * Function used to profile the compile-time of the CMake project for the
+             * target, aggregating the per translation-unit time-traces into a report
+             * of the slowest translation units, headers, templates, and code generation
+             * NOTE: The report is written to "output/build-profile" and requires clang
+             *
+             * @param target String representing the target to compile for
+             * @param budgetPath String representing the path to the time budget (if any)
+             * @return Boolean indicating whether the operation was successful (and no
+             *         translation unit exceeded its time budget)
+             */
+            bool profileBuildCMakeProject(const std::string& target, const std::string& budgetPath="");
 
             /**
              * Function used to compile/build the CMake project for the target
              *
              * @param testType TestType representing CMake test to be run
              * @param testFilter String representing the test filter to apply
+             * @param parallelJobs Unsigned Integer representing the number of test
+             *                     processes to run concurrently (test/sanitize/coverage only)
+             * @param coverageBaseRef String representing the git base reference to limit the
+             *                        coverage report to the changed files (if any)
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool testCMakeProject(TestType testType, const std::string& testFilter="",
+                    unsigned int parallelJobs=1, const std::string& coverageBaseRef="");
+
+            /**
+             * Function used to build and run the CMake project's tests for several
+             * test-types (test or sanitizers) concurrently, printing a result matrix
+             * NOTE: The build jobs are split evenly between the test-types' build trees
+             *
+             * @param testTypes Vector of TestTypes representing the CMake tests to be run
+             * @param testFilter String representing the test filter to apply
+             * @return Boolean indicating whether all builds and tests were successful
+             */
+            bool testCMakeProjectMatrix(const std::vector<TestType>& testTypes,
+                    const std::string& testFilter="");
+
+            /**
+             * Function used to build and run only the CMake project's tests affected by
+             * the files changed against the given git base reference
+             * NOTE: The affected tests are those whose test files (transitively) include a changed file
+             *
+             * @param baseRef String representing the git base reference (ie. "origin/main")
+             * @param parallelJobs Unsigned Integer representing the number of test processes to run concurrently
+             * @return Boolean indicating whether the operation (and all affected tests) were successful
+             */
+            bool testCMakeProjectAffected(const std::string& baseRef, unsigned int parallelJobs=1);
+
+            /**
+             * Function used to build (release) and run the CMake project's benchmarks
+             * NOTE: The results are written to "output/bench" as JSON and TSV
+             *
+             * @param benchFilter String representing the benchmark filter to apply
+             * @param saveBaseline String representing the baseline to save the results as (if any)
+             * @param compareBaseline String representing the baseline to compare against (if any)
+             * @param recordCounters Boolean indicating whether to record the hardware counters
+             *                       (persisted with the commit hash to ".higgs-boson/metrics")
+             * @return Boolean indicating whether the operation was successful (and no
+             *         benchmark regressed against the compared baseline)
+             */
+            bool benchCMakeProject(const std::string& benchFilter="",
+                    const std::string& saveBaseline="", const std::string& compareBaseline="",
+                    bool recordCounters=false);
+
+            /**
+             * Function used to generate the profile-guided optimization profile by
+             * building an instrumented project, running the training workload, and
+             * merging the results into the (source-hash keyed) profile cache
+             * NOTE: Only the default target is supported since the workload is run
+             *       in the builder container
+             *
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool generateOptimizationProfile();
+
+            /**
+             * Function used to profile the CMake project by building an optimized
+             * (frame-pointer enabled) project and running the workload under the
+             * profiler, writing the reports and flame graph to "output/profile"
+             * NOTE: Only the default target is supported since the workload is run
+             *       in the builder container
+             *
+             * @param profileType ProfileType representing the profiler to run
+             * @param workloadType String representing the workload type (run, test, or bench)
+             * @param workload String representing the command to run (run) or the
+             *                 test/benchmark filter to apply (test/bench)
              * @return Boolean indicating whether the operation was successful
              */
-            bool testCMakeProject(TestType testType, const std::string& testFilter="");
+            bool profileCMakeProject(ProfileType profileType,
+                    const std::string& workloadType="test", const std::string& workload="");
 
             /**
              * Destructor used to cleanup the instance
@@ -185,6 +395,174 @@ namespace BitBoson
              * @return Boolean indicating if the operation was successful or not
              */
             bool writeCMakeFile(bool isTesting);
+
+            /**
+             * Internal function used to write the (bundled) benchmark harness and the
+             * benchmark main file (including the benchmark files) to the cache directory
+             *
+             * @return Boolean indicating if the operation was successful or not
+             */
+            bool writeBenchmarkHarness();
+
+            /**
+             * Internal function used to read the per-sample timings from benchmark results
+             *
+             * @param resultsPath String representing the path to the JSON results
+             * @return Map of Strings to Vectors of Doubles representing the benchmarks' samples
+             */
+            std::map<std::string, std::vector<double>> readBenchmarkResults(const std::string& resultsPath);
+
+            /**
+             * Internal function used to compare benchmark results against a saved baseline
+             *
+             * @param resultsPath String representing the path to the JSON results
+             * @param baseline String representing the name of the baseline to compare against
+             * @return Boolean indicating whether no benchmark regressed against the baseline
+             */
+            bool compareBenchmarkResults(const std::string& resultsPath, const std::string& baseline);
+
+            /**
+             * Internal function used to get the headers to precompile, being the
+             * configured headers followed by the most-included external headers
+             * NOTE: Only unconditional includes of the project (non-test) files are counted
+             *
+             * @return Vector of Strings representing the headers to precompile
+             */
+            std::vector<std::string> getPrecompiledHeaders();
+
+            /**
+             * Internal function used to get the testing files split into shards
+             * NOTE: Shards are contiguous (path-ordered) ranges balanced by file size
+             *
+             * @return Vector of Vectors of Strings representing the shards' testing files
+             */
+            std::vector<std::vector<std::string>> getTestShards();
+
+            /**
+             * Internal function used to move a freshly written (".tmp") generated file in
+             * to place only if its contents changed, preserving the timestamps otherwise
+             *
+             * @param filePath String representing the path to the generated file
+             * @return Boolean indicating if the operation was successful or not
+             */
+            bool updateGeneratedFile(const std::string& filePath);
+
+            /**
+             * Internal function used to get the configure step for a persistent build tree,
+             * only re-running CMake (from a fresh cache) when the configuration changed
+             * NOTE: Changes to the generated CMake files themselves are picked-up by Make
+             *
+             * @param configureCommand String representing the CMake configure command
+             * @return String representing the (multi-line) shell configure step
+             */
+            std::string getConfigureStep(const std::string& configureCommand);
+
+            /**
+             * Internal function used to get the CMake configure definitions for the
+             * given (per-target profile) custom compile and link flags
+             *
+             * @param compileFlags Vector of Strings representing the compile flags
+             * @param linkFlags Vector of Strings representing the link flags
+             * @return String representing the (quoted) CMake definitions (if any)
+             */
+            std::string getFlagsDefinitions(const std::vector<std::string>& compileFlags,
+                    const std::vector<std::string>& linkFlags);
+
+            /**
+             * Internal function used to get the perf availability and (non-root) event
+             * access step, lowering the perf_event_paranoid level only when needed
+             *
+             * @param perfEventParanoid String representing the highest usable paranoid level
+             * @return String representing the (multi-line) shell perf access step
+             */
+            std::string getPerfAccessStep(const std::string& perfEventParanoid);
+
+            /**
+             * Internal function used to get the step changing the given kernel setting
+             * only when needed, restoring its previous value once the script exits
+             * NOTE: Kernel settings are not namespaced so they are shared with the host
+             *
+             * @param settingName String representing the kernel setting (ie. "perf_event_paranoid")
+             * @param comparison String representing the shell test comparison to change on
+             * @param value String representing the value to change the kernel setting to
+             * @return String representing the (multi-line) shell kernel setting step
+             */
+            std::string getKernelSettingStep(const std::string& settingName,
+                    const std::string& comparison, const std::string& value);
+
+            /**
+             * Internal function used to get a hash representing the current contents
+             * of the project's (non-testing) source files
+             *
+             * @return String representing the hash of the source files
+             */
+            std::string getSourceHash();
+
+            /**
+             * Internal function used to get the path to the cached profile-guided
+             * optimization profile for the current project sources
+             * NOTE: The profile itself may not have been generated yet
+             *
+             * @return String representing the path to the profile
+             */
+            std::string getOptimizationProfilePath();
+
+            /**
+             * Internal function used to get the name (build directory) and the CMake
+             * variable (if any) used for the given test-type
+             *
+             * @param testType TestType representing the CMake test
+             * @return Pair of Strings representing the test-type's name and CMake variable
+             */
+            std::pair<std::string, std::string> getTestTypeSettings(TestType testType);
+
+            /**
+             * Internal function used to get the test-cases (within the test files) affected
+             * by the files changed against the given git base reference
+             * NOTE: Includes are resolved through the project's source, test, and external
+             *       include directories
+             *
+             * @param baseRef String representing the git base reference (ie. "origin/main")
+             * @param testNames Vector of Strings to fill with the affected test-case names
+             * @return Boolean indicating whether the changes could be determined (a valid base reference)
+             */
+            bool getAffectedTestNames(const std::string& baseRef, std::vector<std::string>& testNames);
+
+            /**
+             * Internal function used to write-out the given test-cases as a Catch2
+             * test-specification (input) file, matching each name exactly
+             *
+             * @param specFilePath String representing the path to write the file to
+             * @param testNames Vector of Strings representing the test-case names
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeTestSpecFile(const std::string& specFilePath, const std::vector<std::string>& testNames);
+
+            /**
+             * Internal function used to merge the (per-process) coverage profiles of
+             * a test run in parallel and report on the covered source files
+             * NOTE: The HTML report is written to "bin/llvm-coverage" in the build tree
+             *
+             * @param testBuildDir String representing the coverage build tree
+             * @param coverageBaseRef String representing the git base reference to limit the
+             *                        report to the changed files (if any)
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool reportCoverage(const std::string& testBuildDir, const std::string& coverageBaseRef);
+
+            /**
+             * Internal function used to run the built tests split across concurrent
+             * processes, balanced using the historical per-test durations
+             *
+             * @param testTypeString String representing the test-type (build directory) name
+             * @param testFilter String representing the test filter to apply
+             * @param parallelJobs Unsigned Integer representing the number of concurrent processes
+             * @param libraryLdPathString String representing the library path (and environment) variables to run with
+             * @return Boolean indicating whether the operation (and all tests) were successful
+             */
+            bool runTestsInParallel(const std::string& testTypeString,
+                    const std::string& testFilter, unsigned int parallelJobs,
+                    const std::string& libraryLdPathString);
     };
 }
 
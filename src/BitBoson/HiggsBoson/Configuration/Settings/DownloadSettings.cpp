@@ -0,0 +1,388 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <iostream>
+#include <BitBoson/HiggsBoson/HiggsBoson.h>
+#include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Configuration/Settings/DownloadSettings.h>
+
+using namespace BitBoson;
+
+/**
+ * Constructor used to setup the (native) download settings object instance
+ *
+ * @param downloadFile String representing the path (prefix) of the download
+ *                     files the instance is going to manage/overwrite
+ * @param syncDir String representing the path to download the modules to
+ */
+DownloadSettings::DownloadSettings(const std::string& downloadFile, const std::string& syncDir)
+{
+
+    // Setup the local member variables
+    _downloadFile = downloadFile;
+    _syncDir = syncDir;
+    _parallelJobs = 4;
+    _retries = 3;
+    _offline = false;
+}
+
+/**
+ * Function used to set the number of modules to download concurrently
+ *
+ * @param parallelJobs Unsigned Integer representing the number of concurrent downloads
+ */
+void DownloadSettings::setParallelJobs(unsigned int parallelJobs)
+{
+
+    // Setup the parallel jobs (always running at least one)
+    _parallelJobs = ((parallelJobs > 0) ? parallelJobs : 1);
+}
+
+/**
+ * Function used to set the number of attempts made to download each module
+ *
+ * @param retries Unsigned Integer representing the number of download attempts
+ */
+void DownloadSettings::setRetries(unsigned int retries)
+{
+
+    // Setup the retries (always attempting at least once)
+    _retries = ((retries > 0) ? retries : 1);
+}
+
+/**
+ * Function used to set the (content-addressed) source cache shared across projects
+ * NOTE: Cached modules are materialized using hardlinks (or reflinks) where possible
+ *
+ * @param sourceCacheDir String representing the source cache directory (empty to disable)
+ * @param offline Boolean indicating whether to resolve modules purely from the cache
+ */
+void DownloadSettings::setSourceCache(const std::string& sourceCacheDir, bool offline)
+{
+
+    // Setup the source cache settings
+    _sourceCacheDir = sourceCacheDir;
+    _offline = offline;
+}
+
+/**
+ * Function used to add a module to download
+ * NOTE: Only "git" modules (with a "url" and optional "rev", "paths", and "filter")
+ *       and "curl" modules (with a "url" and optional "unpack" and "sha256") are supported
+ *
+ * @param name String representing the name of the module
+ * @param properties Map of Strings to Strings representing the module's type and properties
+ * @return Boolean indicating whether the module was added or not
+ */
+bool DownloadSettings::addModule(const std::string& name, const std::map<std::string, std::string>& properties)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the module doesn't exist and is a supported git/curl module
+    auto type = properties.find("type");
+    auto url = properties.find("url");
+    if ((_modules.find(name) == _modules.end()) && (type != properties.end())
+            && ((type->second == "git") || (type->second == "curl"))
+            && (url != properties.end()) && !url->second.empty())
+    {
+
+        // Add-in the given module
+        _modules[name] = properties;
+
+        // Setup the return value accordingly
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to download all of the added modules concurrently, exporting
+ * the tree of each module into its directory (within the sync directory)
+ * NOTE: Git modules are shallow-fetched at exactly the pinned revision (sparse
+ *       and/or partial if configured), while curl modules are resumed,
+ *       checksum-verified, and streamed into their tree
+ *
+ * @return Boolean indicating whether all of the modules were downloaded
+ */
+bool DownloadSettings::download()
+{
+
+    // Only continue if there are modules to download
+    if (_modules.empty())
+        return true;
+
+    // Write-out the download jobs file (one module per line)
+    bool wroteJobs = false;
+    auto jobsFile = FileWriter(_downloadFile + ".jobs");
+    if (jobsFile.isOpen())
+    {
+
+        // Write-in the arguments for downloading each module
+        for (auto& module : _modules)
+        {
+            if (module.second["type"] == "curl")
+            {
+                auto unpack = module.second["unpack"];
+                auto sha256 = module.second["sha256"];
+                jobsFile.writeLine("--curl " + module.first + " " + module.second["url"] + " "
+                        + (unpack.empty() ? "-" : unpack) + " " + (sha256.empty() ? "-" : sha256));
+            }
+            else
+            {
+                auto rev = module.second["rev"];
+                auto paths = module.second["paths"];
+                auto filter = module.second["filter"];
+                jobsFile.writeLine("--git " + module.first + " " + module.second["url"]
+                        + " " + (rev.empty() ? "HEAD" : rev) + " " + (paths.empty() ? "-" : paths)
+                        + " " + (filter.empty() ? "-" : filter));
+            }
+        }
+
+        // Close the jobs file
+        jobsFile.close();
+
+        // Indicate that the jobs file was written properly
+        wroteJobs = true;
+    }
+
+    // Write-out the download shell command file
+    bool wroteDownload = false;
+    auto downloadShellFile = FileWriter(_downloadFile + ".sh");
+    if (downloadShellFile.isOpen())
+    {
+
+        // Write-in the standard Higgs-Boson header for the download file
+        std::string total = std::to_string(_modules.size());
+        downloadShellFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        downloadShellFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        downloadShellFile.writeLine("set -o pipefail");
+        downloadShellFile.writeLine("");
+
+        // Write-in the download locations
+        downloadShellFile.writeLine("# Setup the download locations");
+        downloadShellFile.writeLine("syncDir=" + _syncDir);
+        downloadShellFile.writeLine("statusDir=" + _downloadFile + ".status");
+        downloadShellFile.writeLine("sourceCacheDir=" + _sourceCacheDir);
+        downloadShellFile.writeLine("offline=" + std::string(_offline ? "1" : "0"));
+        downloadShellFile.writeLine("");
+
+        // Write-in the materialization of a cached module into the sync directory
+        // NOTE: Cached files are read-only so in-place edits cannot corrupt the cache
+        downloadShellFile.writeLine("# Materialize a cached module (hardlinking, reflinking, or copying its files)");
+        downloadShellFile.writeLine("materialize() {");
+        downloadShellFile.writeLine("    rm -rf $syncDir/.$1.link");
+        downloadShellFile.writeLine("    cp -al $2 $syncDir/.$1.link 2> /dev/null"
+                " || { rm -rf $syncDir/.$1.link && cp -a --reflink=auto $2 $syncDir/.$1.link; } || return 1");
+        downloadShellFile.writeLine("    rm -rf $syncDir/$1 && mv $syncDir/.$1.link $syncDir/$1");
+        downloadShellFile.writeLine("}");
+        downloadShellFile.writeLine("");
+
+        // Write-in the reporting of a module's download status (with the overall progress)
+        downloadShellFile.writeLine("# Report the download status of a module");
+        downloadShellFile.writeLine("report() {");
+        downloadShellFile.writeLine("    echo $2 > $statusDir/$1");
+        downloadShellFile.writeLine("    echo \"[$(ls $statusDir | wc -l)/" + total + "] Downloading $1 ... $2$3\"");
+        downloadShellFile.writeLine("}");
+        downloadShellFile.writeLine("");
+
+        // Write-in the check for the tools needed to extract an archive
+        downloadShellFile.writeLine("# Ensure the given tools are installed to extract an archive");
+        downloadShellFile.writeLine("requireTools() {");
+        downloadShellFile.writeLine("    archiveFile=$1");
+        downloadShellFile.writeLine("    shift");
+        downloadShellFile.writeLine("    for tool in \"$@\"; do");
+        downloadShellFile.writeLine("        if ! command -v $tool > /dev/null 2>&1; then");
+        downloadShellFile.writeLine("            echo \"Cannot extract $(basename $archiveFile): $tool is not installed\"");
+        downloadShellFile.writeLine("            return 1");
+        downloadShellFile.writeLine("        fi");
+        downloadShellFile.writeLine("    done");
+        downloadShellFile.writeLine("}");
+        downloadShellFile.writeLine("");
+
+        // Write-in the streamed extraction of a downloaded archive into a module's tree
+        // NOTE: Compressed tarballs are decompressed while being extracted (never to disk)
+        downloadShellFile.writeLine("# Extract a downloaded archive (or copy a plain file) into a tree");
+        downloadShellFile.writeLine("extract() {");
+        downloadShellFile.writeLine("    case \"$3:$(basename $1)\" in");
+        downloadShellFile.writeLine("        tar:*.zst|tar:*.tzst) requireTools $1 zstd tar && zstd -dcq $1 | tar -x -C $2 ;;");
+        downloadShellFile.writeLine("        tar:*.xz|tar:*.txz) requireTools $1 xz tar && xz -dc $1 | tar -x -C $2 ;;");
+        downloadShellFile.writeLine("        tar:*.gz|tar:*.tgz) requireTools $1 gzip tar && gzip -dc $1 | tar -x -C $2 ;;");
+        downloadShellFile.writeLine("        tar:*.bz2|tar:*.tbz2) requireTools $1 bzip2 tar && bzip2 -dc $1 | tar -x -C $2 ;;");
+        downloadShellFile.writeLine("        tar:*) requireTools $1 tar && tar -xf $1 -C $2 ;;");
+        downloadShellFile.writeLine("        zip:*) requireTools $1 unzip && unzip -qo $1 -d $2 ;;");
+        downloadShellFile.writeLine("        *) cp $1 $2/ ;;");
+        downloadShellFile.writeLine("    esac");
+        downloadShellFile.writeLine("}");
+        downloadShellFile.writeLine("");
+
+        // Write-in the download of a single curl module (with retries)
+        // NOTE: Partial downloads are resumed (restarting if the server cannot resume them),
+        //       while checksummed archives are cached by their SHA-256 checksum
+        downloadShellFile.writeLine("# Download a single curl module (run by the concurrent workers below)");
+        downloadShellFile.writeLine("if [ \"$1\" = \"--curl\" ]; then");
+        downloadShellFile.writeLine("    name=$2");
+        downloadShellFile.writeLine("    url=$3");
+        downloadShellFile.writeLine("    unpack=$4");
+        downloadShellFile.writeLine("    sha256=$5");
+        downloadShellFile.writeLine("    workDir=$syncDir/.$name.download");
+        downloadShellFile.writeLine("    archiveName=$(basename \"${url%%[?#]*}\")");
+        downloadShellFile.writeLine("    archive=$workDir/$archiveName");
+        downloadShellFile.writeLine("    if [ -n \"$sourceCacheDir\" ] && [ \"$sha256\" != \"-\" ]; then");
+        downloadShellFile.writeLine("        archive=$sourceCacheDir/archives/$sha256/$archiveName");
+        downloadShellFile.writeLine("    fi");
+        downloadShellFile.writeLine("    verify() {");
+        downloadShellFile.writeLine("        [ \"$sha256\" = \"-\" ] || [ \"$(sha256sum < $1 | cut -d' ' -f1)\" = \"$sha256\" ]");
+        downloadShellFile.writeLine("    }");
+        downloadShellFile.writeLine("    ready=0");
+        downloadShellFile.writeLine("    suffix=\"\"");
+        downloadShellFile.writeLine("    if [ \"$sha256\" != \"-\" ] && [ -f $archive ] && verify $archive; then");
+        downloadShellFile.writeLine("        ready=1");
+        downloadShellFile.writeLine("        suffix=\" (cached)\"");
+        downloadShellFile.writeLine("    elif [ $offline = 1 ]; then");
+        downloadShellFile.writeLine("        report $name FAILED \" (not in the source cache)\"");
+        downloadShellFile.writeLine("        exit 1");
+        downloadShellFile.writeLine("    else");
+        downloadShellFile.writeLine("        mkdir -p $workDir $(dirname $archive)");
+        downloadShellFile.writeLine("        for attempt in $(seq 1 " + std::to_string(_retries) + "); do");
+        downloadShellFile.writeLine("            curl -fsSL -C - -o $workDir/$archiveName.part \"$url\"");
+        downloadShellFile.writeLine("            result=$?");
+        downloadShellFile.writeLine("            if [ $result = 33 ] || [ $result = 22 ]; then");
+        downloadShellFile.writeLine("                rm -f $workDir/$archiveName.part");
+        downloadShellFile.writeLine("                curl -fsSL -o $workDir/$archiveName.part \"$url\"");
+        downloadShellFile.writeLine("                result=$?");
+        downloadShellFile.writeLine("            fi");
+        downloadShellFile.writeLine("            if [ $result = 0 ] && verify $workDir/$archiveName.part; then");
+        downloadShellFile.writeLine("                mv $workDir/$archiveName.part $archive.$$ && mv -f $archive.$$ $archive");
+        downloadShellFile.writeLine("                ready=1");
+        downloadShellFile.writeLine("                break");
+        downloadShellFile.writeLine("            elif [ $result = 0 ]; then");
+        downloadShellFile.writeLine("                echo \"Checksum mismatch for $name (expected $sha256)\"");
+        downloadShellFile.writeLine("                rm -f $workDir/$archiveName.part");
+        downloadShellFile.writeLine("            fi");
+        downloadShellFile.writeLine("            [ $attempt -lt " + std::to_string(_retries) + " ] && sleep $attempt");
+        downloadShellFile.writeLine("        done");
+        downloadShellFile.writeLine("    fi");
+        downloadShellFile.writeLine("    if [ $ready = 1 ] && rm -rf $workDir/tree && mkdir -p $workDir/tree"
+                " && extract $archive $workDir/tree $unpack; then");
+        downloadShellFile.writeLine("        rm -rf $syncDir/$name && mv $workDir/tree $syncDir/$name && rm -rf $workDir");
+        downloadShellFile.writeLine("        report $name OK \"$suffix\"");
+        downloadShellFile.writeLine("        exit 0");
+        downloadShellFile.writeLine("    fi");
+        downloadShellFile.writeLine("    rm -rf $workDir/tree");
+        downloadShellFile.writeLine("    report $name FAILED");
+        downloadShellFile.writeLine("    exit 1");
+        downloadShellFile.writeLine("fi");
+        downloadShellFile.writeLine("");
+
+        // Write-in the download of a single git module (with retries)
+        // NOTE: Pinned revisions are cached by their URL, revision, and sparse paths, while
+        //       servers which do not allow fetching a commit directly fall back to fetching
+        //       all refs; sparse/partial modules are checked-out (prefetching only the blobs
+        //       within the sparse paths) rather than archived
+        downloadShellFile.writeLine("# Download a single git module (run by the concurrent workers below)");
+        downloadShellFile.writeLine("if [ \"$1\" = \"--git\" ]; then");
+        downloadShellFile.writeLine("    name=$2");
+        downloadShellFile.writeLine("    url=$3");
+        downloadShellFile.writeLine("    rev=$4");
+        downloadShellFile.writeLine("    paths=$5");
+        downloadShellFile.writeLine("    filter=\"\"");
+        downloadShellFile.writeLine("    [ \"$6\" != \"-\" ] && filter=\"--filter=$6\"");
+        downloadShellFile.writeLine("    workDir=$syncDir/.$name.download");
+        downloadShellFile.writeLine("    cacheKey=\"$url@$rev\"");
+        downloadShellFile.writeLine("    [ \"$paths\" != \"-\" ] && cacheKey=\"$cacheKey:$paths\"");
+        downloadShellFile.writeLine("    cacheDir=\"\"");
+        downloadShellFile.writeLine("    if [ -n \"$sourceCacheDir\" ] && [ \"$rev\" != \"HEAD\" ]; then");
+        downloadShellFile.writeLine("        cacheDir=$sourceCacheDir/git/$(echo -n \"$cacheKey\" | sha256sum | cut -d' ' -f1)");
+        downloadShellFile.writeLine("    fi");
+        downloadShellFile.writeLine("    if [ -n \"$cacheDir\" ] && [ -d $cacheDir ] && materialize $name $cacheDir; then");
+        downloadShellFile.writeLine("        report $name OK \" (cached)\"");
+        downloadShellFile.writeLine("        exit 0");
+        downloadShellFile.writeLine("    fi");
+        downloadShellFile.writeLine("    if [ $offline = 1 ]; then");
+        downloadShellFile.writeLine("        report $name FAILED \" (not in the source cache)\"");
+        downloadShellFile.writeLine("        exit 1");
+        downloadShellFile.writeLine("    fi");
+        downloadShellFile.writeLine("    for attempt in $(seq 1 " + std::to_string(_retries) + "); do");
+        downloadShellFile.writeLine("        rm -rf $workDir && mkdir -p $workDir/tree && git init -q $workDir/repo");
+        downloadShellFile.writeLine("        git -C $workDir/repo remote add origin $url");
+        downloadShellFile.writeLine("        if [ \"$paths\" != \"-\" ]; then");
+        downloadShellFile.writeLine("            git -C $workDir/repo config core.sparseCheckout true");
+        downloadShellFile.writeLine("            echo \"$paths\" | tr ',' '\\n' > $workDir/repo/.git/info/sparse-checkout");
+        downloadShellFile.writeLine("        fi");
+        downloadShellFile.writeLine("        if git -C $workDir/repo fetch -q $filter --depth 1 origin $rev 2> /dev/null; then");
+        downloadShellFile.writeLine("            commit=$(git -C $workDir/repo rev-parse -q --verify \"FETCH_HEAD^{commit}\")");
+        downloadShellFile.writeLine("        elif git -C $workDir/repo fetch -q $filter --tags origin \"+refs/heads/*:refs/remotes/origin/*\"; then");
+        downloadShellFile.writeLine("            commit=$(git -C $workDir/repo rev-parse -q --verify \"$rev^{commit}\""
+                " || git -C $workDir/repo rev-parse -q --verify \"origin/$rev^{commit}\")");
+        downloadShellFile.writeLine("        else");
+        downloadShellFile.writeLine("            commit=\"\"");
+        downloadShellFile.writeLine("        fi");
+        downloadShellFile.writeLine("        if [ -z \"$commit\" ]; then");
+        downloadShellFile.writeLine("            result=1");
+        downloadShellFile.writeLine("        elif [ \"$paths\" != \"-\" ] || [ -n \"$filter\" ]; then");
+        downloadShellFile.writeLine("            git --git-dir=$workDir/repo/.git --work-tree=$workDir/tree checkout -q $commit");
+        downloadShellFile.writeLine("            result=$?");
+        downloadShellFile.writeLine("        else");
+        downloadShellFile.writeLine("            git -C $workDir/repo archive --format=tar $commit | tar -x -C $workDir/tree");
+        downloadShellFile.writeLine("            result=$?");
+        downloadShellFile.writeLine("        fi");
+        downloadShellFile.writeLine("        if [ $result = 0 ]; then");
+        downloadShellFile.writeLine("            if [ -n \"$cacheDir\" ]; then");
+        downloadShellFile.writeLine("                find $workDir/tree -type f -exec chmod a-w {} +");
+        downloadShellFile.writeLine("                mkdir -p $(dirname $cacheDir) && mv $workDir/tree $cacheDir.$$");
+        downloadShellFile.writeLine("                mv -T $cacheDir.$$ $cacheDir 2> /dev/null || rm -rf $cacheDir.$$");
+        downloadShellFile.writeLine("                materialize $name $cacheDir && rm -rf $workDir && report $name OK && exit 0");
+        downloadShellFile.writeLine("            else");
+        downloadShellFile.writeLine("                rm -rf $syncDir/$name && mv $workDir/tree $syncDir/$name && rm -rf $workDir");
+        downloadShellFile.writeLine("                report $name OK && exit 0");
+        downloadShellFile.writeLine("            fi");
+        downloadShellFile.writeLine("        fi");
+        downloadShellFile.writeLine("        [ $attempt -lt " + std::to_string(_retries) + " ] && sleep $attempt");
+        downloadShellFile.writeLine("    done");
+        downloadShellFile.writeLine("    rm -rf $workDir");
+        downloadShellFile.writeLine("    report $name FAILED");
+        downloadShellFile.writeLine("    exit 1");
+        downloadShellFile.writeLine("fi");
+        downloadShellFile.writeLine("");
+
+        // Write-in the concurrent download of all of the modules
+        downloadShellFile.writeLine("# Download the modules concurrently");
+        downloadShellFile.writeLine("rm -rf $statusDir && mkdir -p $statusDir $syncDir");
+        downloadShellFile.writeLine("xargs -P " + std::to_string(_parallelJobs) + " -L 1 bash "
+                + _downloadFile + ".sh < " + _downloadFile + ".jobs");
+
+        // Close the download file
+        downloadShellFile.close();
+
+        // Indicate that the download file was written properly
+        wroteDownload = true;
+    }
+
+    // Run the download command and return the results
+    std::cout << "Downloading " << _modules.size() << " External Dependencies ("
+            << _parallelJobs << " concurrently)" << std::endl;
+    return (wroteJobs && wroteDownload && HiggsBoson::RunTypeSingleton::executeInContainer(
+            "bash " + _downloadFile + ".sh"));
+}
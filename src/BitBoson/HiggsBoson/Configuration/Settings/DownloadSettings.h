@@ -0,0 +1,109 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_DOWNLOAD_SETTINGS_H
+#define HIGGS_BOSON_DOWNLOAD_SETTINGS_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace BitBoson
+{
+
+    class DownloadSettings
+    {
+
+        // Private member variables
+        private:
+            std::string _downloadFile;
+            std::string _syncDir;
+            unsigned int _parallelJobs;
+            unsigned int _retries;
+            std::string _sourceCacheDir;
+            bool _offline;
+            std::map<std::string, std::map<std::string, std::string>> _modules;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (native) download settings object instance
+             *
+             * @param downloadFile String representing the path (prefix) of the download
+             *                     files the instance is going to manage/overwrite
+             * @param syncDir String representing the path to download the modules to
+             */
+            DownloadSettings(const std::string& downloadFile, const std::string& syncDir);
+
+            /**
+             * Function used to set the number of modules to download concurrently
+             *
+             * @param parallelJobs Unsigned Integer representing the number of concurrent downloads
+             */
+            void setParallelJobs(unsigned int parallelJobs);
+
+            /**
+             * Function used to set the number of attempts made to download each module
+             *
+             * @param retries Unsigned Integer representing the number of download attempts
+             */
+            void setRetries(unsigned int retries);
+
+            /**
+             * Function used to set the (content-addressed) source cache shared across projects
+             * NOTE: Cached modules are materialized using hardlinks (or reflinks) where possible
+             *
+             * @param sourceCacheDir String representing the source cache directory (empty to disable)
+             * @param offline Boolean indicating whether to resolve modules purely from the cache
+             */
+            void setSourceCache(const std::string& sourceCacheDir, bool offline=false);
+
+            /**
+             * Function used to add a module to download
+             * NOTE: Only "git" modules (with a "url" and optional "rev", "paths", and "filter")
+             *       and "curl" modules (with a "url" and optional "unpack" and "sha256") are supported
+             *
+             * @param name String representing the name of the module
+             * @param properties Map of Strings to Strings representing the module's type and properties
+             * @return Boolean indicating whether the module was added or not
+             */
+            bool addModule(const std::string& name, const std::map<std::string, std::string>& properties);
+
+            /**
+             * Function used to download all of the added modules concurrently, exporting
+             * the tree of each module into its directory (within the sync directory)
+             * NOTE: Git modules are shallow-fetched at exactly the pinned revision (sparse
+             *       and/or partial if configured), while curl modules are resumed,
+             *       checksum-verified, and streamed into their tree
+             *
+             * @return Boolean indicating whether all of the modules were downloaded
+             */
+            bool download();
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~DownloadSettings() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_DOWNLOAD_SETTINGS_H
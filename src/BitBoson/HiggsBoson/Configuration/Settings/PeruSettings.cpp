@@ -19,10 +19,15 @@
  *     - Tyler Parcell <OriginLegend>
  */
 
+#include <fstream>
+#include <iostream>
+#include <algorithm>
 #include <BitBoson/HiggsBoson/HiggsBoson.h>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
 #include <BitBoson/HiggsBoson/Utils/ExecShell.h>
 #include <BitBoson/HiggsBoson/Utils/FileWriter.h>
 #include <BitBoson/HiggsBoson/Configuration/Settings/PeruSettings.h>
+#include <BitBoson/HiggsBoson/Configuration/Settings/DownloadSettings.h>
 
 using namespace BitBoson;
 
@@ -41,6 +46,45 @@ PeruSettings::PeruSettings(const std::string& peruFile,
     // Setup the local member variables
     _peruFile = peruFile;
     _peruSyncDir = peruSyncDir;
+    _nativeDownloads = false;
+    _downloadJobs = 4;
+    _downloadRetries = 3;
+    _offline = false;
+}
+
+/**
+ * Function used to set whether git/curl modules are downloaded natively (shallow
+ * and concurrently) rather than through Peru
+ * NOTE: Checksummed, sparse, and partial modules are always downloaded natively
+ *
+ * @param nativeDownloads Boolean indicating whether to download git/curl modules natively
+ * @param parallelJobs Unsigned Integer representing the number of concurrent downloads
+ * @param retries Unsigned Integer representing the number of download attempts per module
+ */
+void PeruSettings::setNativeDownloads(bool nativeDownloads, unsigned int parallelJobs, unsigned int retries)
+{
+
+    // Setup the native download settings
+    _nativeDownloads = nativeDownloads;
+    _downloadJobs = parallelJobs;
+    _downloadRetries = retries;
+}
+
+/**
+ * Function used to set the (content-addressed) source cache shared across projects
+ * NOTE: Peru-synced modules use a shared Peru cache within the source cache (and
+ *       store pinned git modules in it for the native downloader), while all
+ *       modules are resolved natively from the source cache when offline
+ *
+ * @param sourceCacheDir String representing the source cache directory (empty to disable)
+ * @param offline Boolean indicating whether to resolve modules purely from the cache
+ */
+void PeruSettings::setSourceCache(const std::string& sourceCacheDir, bool offline)
+{
+
+    // Setup the source cache settings
+    _sourceCacheDir = sourceCacheDir;
+    _offline = offline;
 }
 
 /**
@@ -119,6 +163,8 @@ bool PeruSettings::addDependencyProperty(const std::string& name,
 /**
  * Function used to perform a Peru-sync operation on the configured
  * location/directory based on the supplied peru sync directory
+ * NOTE: Only modules whose definition or synced files differ from the
+ *       lockfile (".lock" alongside the Peru file) are re-synced
  *
  * @return Boolean indcating whether the Peru sync was performed
  */
@@ -128,32 +174,175 @@ bool PeruSettings::peruSync()
     // Write the Peru file to disk
     auto wroteFile = writePeruFile();
 
-    // Write-out the Peru-sync shell command file
-    bool wroteSync = false;
-    auto peruSyncFile = FileWriter(_peruFile + ".sync.sh");
-    if (peruSyncFile.isOpen())
+    // Hash the synced directories of the modules whose definition is unchanged
+    auto modules = getModules();
+    auto lockedModules = readLockFile();
+    std::vector<std::string> unchangedModules;
+    for (const auto& module : modules)
+    {
+        auto lockedModule = lockedModules.find(module.first);
+        if (lockedModule != lockedModules.end())
+        {
+            auto lockedProperties = lockedModule->second;
+            lockedProperties.erase("tree");
+            if (lockedProperties == module.second)
+                unchangedModules.push_back(module.first);
+        }
+    }
+    auto treeHashes = getTreeHashes(unchangedModules);
+
+    // Determine the modules which need to be (re-)synced or removed
+    std::vector<std::string> staleModules;
+    std::vector<std::string> removedModules;
+    for (const auto& module : modules)
+        if ((treeHashes.find(module.first) == treeHashes.end())
+                || (treeHashes[module.first] != lockedModules[module.first]["tree"]))
+            staleModules.push_back(module.first);
+    for (const auto& lockedModule : lockedModules)
+        if (modules.find(lockedModule.first) == modules.end())
+            removedModules.push_back(lockedModule.first);
+
+    // Skip the sync altogether if all modules match the lockfile
+    if (wroteFile && staleModules.empty() && removedModules.empty())
     {
+        std::cout << "Synchronizing External Dependencies ... UP-TO-DATE" << std::endl;
+        return true;
+    }
 
-        // Write-in the standard Higgs-Boson header for the Peru file
-        peruSyncFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
-        peruSyncFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
-        peruSyncFile.writeLine("");
+    // Hand the stale git/curl modules to the native downloader (if enabled)
+    // NOTE: Modules with native-only properties (such as checksums or sparse paths)
+    //       always go to the native downloader as Peru cannot honor them and, when
+    //       offline, all modules do as Peru may otherwise reach the network
+    auto downloadSettings = DownloadSettings(_peruFile + ".download", _peruSyncDir);
+    downloadSettings.setParallelJobs(_downloadJobs);
+    downloadSettings.setRetries(_downloadRetries);
+    downloadSettings.setSourceCache(_sourceCacheDir, _offline);
+    std::vector<std::string> peruModules;
+    for (const auto& moduleName : staleModules)
+    {
+        bool nativeOnly = false;
+        for (const auto& property : modules[moduleName])
+            nativeOnly = (nativeOnly || isNativeOnlyProperty(property.first));
+        if ((!_nativeDownloads && !nativeOnly && !_offline) || !downloadSettings.addModule(moduleName, modules[moduleName]))
+            peruModules.push_back(moduleName);
+    }
 
-        // Write-in the actual Peru-sync command
-        peruSyncFile.writeLine("# Run the Peru-sync Operation");
-        peruSyncFile.write("peru --file=" + _peruFile);
-        peruSyncFile.writeLine(" --sync-dir=" + _peruSyncDir + " sync --force");
+    // Fail before running Peru if any module cannot be resolved offline
+    if (_offline && !peruModules.empty())
+    {
+        std::cout << "Synchronizing External Dependencies ... FAILED" << std::endl;
+        for (const auto& moduleName : peruModules)
+            std::cout << "    " << moduleName << " cannot be resolved offline (not a git/curl module)" << std::endl;
+        return false;
+    }
+
+    // Only run Peru if there are modules left for it to sync (or remove)
+    bool retFlag = wroteFile;
+    if (retFlag && (!peruModules.empty() || !removedModules.empty()))
+    {
 
-        // Close the Peru-sync file
-        peruSyncFile.close();
+        // Write-out the Peru-sync shell command file
+        bool wroteSync = false;
+        auto peruSyncFile = FileWriter(_peruFile + ".sync.sh");
+        if (peruSyncFile.isOpen())
+        {
 
-        // Indicate that the sync file was written properly
-        wroteSync = true;
+            // Write-in the standard Higgs-Boson header for the Peru file
+            peruSyncFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+            peruSyncFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+            peruSyncFile.writeLine("set -e");
+            peruSyncFile.writeLine("");
+
+            // Write-in the shared Peru cache (if there is a source cache)
+            if (!_sourceCacheDir.empty())
+            {
+                peruSyncFile.writeLine("# Share the Peru cache across projects");
+                peruSyncFile.writeLine("export PERU_CACHE_DIR=" + _sourceCacheDir + "/peru");
+                peruSyncFile.writeLine("");
+            }
+
+            // Write-in the actual Peru-sync command when all modules are stale
+            if (peruModules.size() == modules.size())
+            {
+                peruSyncFile.writeLine("# Run the Peru-sync Operation");
+                peruSyncFile.write("peru --file=" + _peruFile);
+                peruSyncFile.writeLine(" --sync-dir=" + _peruSyncDir + " sync --force");
+            }
+
+            // Otherwise write-in the Peru-copy of each stale module alone
+            // NOTE: Modules are copied aside first to keep the old files if the copy fails
+            else
+            {
+                peruSyncFile.writeLine("# Run the Peru-copy Operation for the changed modules");
+                for (const auto& moduleName : peruModules)
+                {
+                    std::string moduleDir = _peruSyncDir + "/" + moduleName;
+                    peruSyncFile.writeLine("rm -rf " + _peruSyncDir + "/." + moduleName + ".tmp");
+                    peruSyncFile.write("peru --file=" + _peruFile + " --sync-dir=" + _peruSyncDir);
+                    peruSyncFile.writeLine(" copy " + moduleName + " " + _peruSyncDir + "/." + moduleName + ".tmp");
+                    peruSyncFile.writeLine("rm -rf " + moduleDir + " && mv " + _peruSyncDir + "/." + moduleName + ".tmp " + moduleDir);
+                }
+            }
+            peruSyncFile.writeLine("");
+
+            // Write-in the storing of the synced (pinned git) modules in the source cache
+            // NOTE: The cache is keyed as the native downloader's so it can materialize
+            //       them later (ie. offline), while the synced files are hardlinked into
+            //       the cache (and made read-only) rather than copied where possible
+            std::vector<std::string> cachedModules;
+            for (const auto& moduleName : peruModules)
+                if (!getSourceCacheDir(modules[moduleName]).empty())
+                    cachedModules.push_back(moduleName);
+            if (!cachedModules.empty())
+            {
+                peruSyncFile.writeLine("# Store the synced modules in the (content-addressed) source cache");
+                peruSyncFile.writeLine("mkdir -p " + _sourceCacheDir + "/git");
+                for (const auto& moduleName : cachedModules)
+                {
+                    std::string moduleDir = _peruSyncDir + "/" + moduleName;
+                    std::string cacheDir = getSourceCacheDir(modules[moduleName]);
+                    peruSyncFile.writeLine("if [ ! -d " + cacheDir + " ]; then");
+                    peruSyncFile.writeLine("    find " + moduleDir + " -type f -exec chmod a-w {} +");
+                    peruSyncFile.writeLine("    cp -al " + moduleDir + " " + cacheDir + ".$$ 2> /dev/null"
+                            " || { rm -rf " + cacheDir + ".$$ && cp -a --reflink=auto " + moduleDir + " " + cacheDir + ".$$; }");
+                    peruSyncFile.writeLine("    mv -T " + cacheDir + ".$$ " + cacheDir + " 2> /dev/null || rm -rf " + cacheDir + ".$$");
+                    peruSyncFile.writeLine("fi");
+                }
+                peruSyncFile.writeLine("");
+            }
+
+            // Write-in the removal of any modules which are no longer used
+            peruSyncFile.writeLine("# Remove the modules which are no longer used");
+            for (const auto& moduleName : removedModules)
+                peruSyncFile.writeLine("rm -rf " + _peruSyncDir + "/" + moduleName);
+
+            // Close the Peru-sync file
+            peruSyncFile.close();
+
+            // Indicate that the sync file was written properly
+            wroteSync = true;
+        }
+
+        // Run the Peru-sync command
+        retFlag = (wroteSync && HiggsBoson::RunTypeSingleton::executeInContainer(
+                "Synchronizing External Dependencies", "bash " + _peruFile + ".sync.sh"));
     }
 
-    // Run the Peru-sync command and return the results
-    return (wroteFile && wroteSync && HiggsBoson::RunTypeSingleton::executeInContainer(
-            "Synchronizing External Dependencies", "bash " + _peruFile + ".sync.sh"));
+    // Run the native download of the remaining modules
+    retFlag = (retFlag && downloadSettings.download());
+
+    // Record the synced modules (and their tree hashes) in the lockfile
+    if (retFlag)
+    {
+        for (const auto& treeHash : getTreeHashes(staleModules))
+            treeHashes[treeHash.first] = treeHash.second;
+        for (auto& module : modules)
+            module.second["tree"] = treeHashes[module.first];
+        retFlag = writeLockFile(modules);
+    }
+
+    // Return the return flag
+    return retFlag;
 }
 
 /**
@@ -205,22 +394,23 @@ bool PeruSettings::writePeruFile()
             peruFile.writeLine("# Setup the import for " + dep.first);
             peruFile.writeLine(dep.second["type"] + " module " + dep.first + ":");
             for (const auto& property : dep.second)
-                if (property.first != "type")
+                if ((property.first != "type") && !isNativeOnlyProperty(property.first))
                     peruFile.writeLine(" " + property.first + ": " + property.second);
             peruFile.writeLine("");
         }
 
         // Write-in the catch2 library download
+        auto modules = getModules();
         peruFile.writeLine("# Setup the import for catch2 integration");
         peruFile.writeLine("git module catch2higgsboson:");
-        peruFile.writeLine(" rev: v2.12.4");
-        peruFile.writeLine(" url: https://github.com/bitboson-deps/Catch2.git");
+        peruFile.writeLine(" rev: " + modules["catch2higgsboson"]["rev"]);
+        peruFile.writeLine(" url: " + modules["catch2higgsboson"]["url"]);
 
         // Write-in the plibsys library download
         peruFile.writeLine("# Setup the import for catch2 integration");
         peruFile.writeLine("git module plibsyshiggsboson:");
-        peruFile.writeLine(" rev: 0.0.4");
-        peruFile.writeLine(" url: https://github.com/saprykin/plibsys.git");
+        peruFile.writeLine(" rev: " + modules["plibsyshiggsboson"]["rev"]);
+        peruFile.writeLine(" url: " + modules["plibsyshiggsboson"]["url"]);
 
         // Close the Peru file
         peruFile.close();
@@ -232,3 +422,223 @@ bool PeruSettings::writePeruFile()
     // Return the return flag
     return retFlag;
 }
+
+/**
+ * Internal function used to get all of the modules to sync (being the
+ * configured dependencies followed by the built-in integrations)
+ *
+ * @return Map of Strings to Property Maps representing the modules
+ */
+std::map<std::string, std::map<std::string, std::string>> PeruSettings::getModules()
+{
+
+    // Add-in the configured dependencies
+    std::map<std::string, std::map<std::string, std::string>> retMap;
+    for (const auto& dep : _dependencies)
+        retMap[dep.first] = std::map<std::string, std::string>(dep.second.begin(), dep.second.end());
+
+    // Add-in the catch2 and plibsys integrations
+    retMap["catch2higgsboson"] = {{"type", "git"}, {"rev", "v2.12.4"},
+            {"url", "https://github.com/bitboson-deps/Catch2.git"}};
+    retMap["plibsyshiggsboson"] = {{"type", "git"}, {"rev", "0.0.4"},
+            {"url", "https://github.com/saprykin/plibsys.git"}};
+
+    // Return the return map
+    return retMap;
+}
+
+/**
+ * Internal function used to check whether the given module property is only
+ * understood by the native downloader (and not by Peru)
+ * NOTE: Modules with such properties are always downloaded natively
+ *
+ * @param property String representing the module property to check
+ * @return Boolean indicating whether the property is native-only
+ */
+bool PeruSettings::isNativeOnlyProperty(const std::string& property)
+{
+
+    // Checksums, sparse-checkout paths, and partial-clone filters are native-only
+    return ((property == "sha256") || (property == "paths") || (property == "filter"));
+}
+
+/**
+ * Internal function used to get the (content-addressed) source cache directory
+ * of the given module, as used by the native downloader
+ * NOTE: Only git modules pinned to a revision (without any other properties
+ *       which would change their synced files) are cached
+ *
+ * @param properties Map of Strings to Strings representing the module's type and properties
+ * @return String representing the module's source cache directory (empty if not cached)
+ */
+std::string PeruSettings::getSourceCacheDir(const std::map<std::string, std::string>& properties)
+{
+
+    // Create a return value
+    std::string retVal;
+
+    // Only continue for pinned git modules (when there is a source cache)
+    bool pinnedOnly = true;
+    for (const auto& property : properties)
+        pinnedOnly = (pinnedOnly && ((property.first == "type") || (property.first == "url") || (property.first == "rev")));
+    auto type = properties.find("type");
+    auto url = properties.find("url");
+    auto rev = properties.find("rev");
+    if (pinnedOnly && !_sourceCacheDir.empty() && (type != properties.end()) && (type->second == "git")
+            && (url != properties.end()) && (rev != properties.end()))
+    {
+
+        // Key the module by its URL and revision (as the native downloader does)
+        std::string urlValue = url->second;
+        std::string revValue = rev->second;
+        Utils::trim(urlValue);
+        Utils::trim(revValue);
+        if (!urlValue.empty() && !revValue.empty() && (revValue != "HEAD"))
+            retVal = _sourceCacheDir + "/git/" + Utils::sha256(urlValue + "@" + revValue);
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to read-in the modules recorded in the lockfile
+ * NOTE: The synced tree hash is recorded as the "tree" property
+ *
+ * @return Map of Strings to Property Maps representing the locked modules
+ */
+std::map<std::string, std::map<std::string, std::string>> PeruSettings::readLockFile()
+{
+
+    // Setup the return map
+    std::map<std::string, std::map<std::string, std::string>> retMap;
+
+    // Read-in the lockfile line-by-line (if it exists)
+    std::ifstream lockFile(_peruFile + ".lock");
+    std::string moduleName;
+    std::string line;
+    while (std::getline(lockFile, line))
+    {
+
+        // Handle the module definitions of the form "<type> module <name>:"
+        auto modulePos = line.find(" module ");
+        if (!line.empty() && (line[0] != ' ') && (line[0] != '#')
+                && (modulePos != std::string::npos) && (line.back() == ':'))
+        {
+            moduleName = line.substr(modulePos + 8, line.size() - modulePos - 9);
+            retMap[moduleName]["type"] = line.substr(0, modulePos);
+        }
+
+        // Handle the module properties of the form " <property>: <value>"
+        else if (!moduleName.empty() && !line.empty() && (line[0] == ' ')
+                && (line.find(": ") != std::string::npos))
+        {
+            auto property = line.substr(1, line.find(": ") - 1);
+            retMap[moduleName][property] = line.substr(line.find(": ") + 2);
+        }
+    }
+
+    // Return the return map
+    return retMap;
+}
+
+/**
+ * Internal function used to write-out the given modules to the lockfile
+ *
+ * @param modules Map of Strings to Property Maps representing the modules to lock
+ * @return Boolean indicating whether the lockfile was written
+ */
+bool PeruSettings::writeLockFile(const std::map<std::string, std::map<std::string, std::string>>& modules)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Open the lockfile
+    auto lockFile = FileWriter(_peruFile + ".lock");
+    if (lockFile.isOpen())
+    {
+
+        // Write-in the standard Higgs-Boson header for the lockfile
+        lockFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        lockFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        lockFile.writeLine("");
+
+        // Write-in the individual (synced) module sections of the lockfile
+        for (const auto& module : modules)
+        {
+            lockFile.writeLine(module.second.at("type") + " module " + module.first + ":");
+            for (const auto& property : module.second)
+                if (property.first != "type")
+                    lockFile.writeLine(" " + property.first + ": " + property.second);
+            lockFile.writeLine("");
+        }
+
+        // Close the lockfile
+        lockFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to get the tree hash (of all file contents) of
+ * the synced directory of each of the given modules
+ * NOTE: Modules without a synced directory are omitted
+ *
+ * @param moduleNames Vector of Strings representing the modules to hash
+ * @return Map of Strings to Strings representing the modules' tree hashes
+ */
+std::map<std::string, std::string> PeruSettings::getTreeHashes(const std::vector<std::string>& moduleNames)
+{
+
+    // Setup the return map
+    std::map<std::string, std::string> retMap;
+
+    // Only continue if there are modules to hash
+    if (moduleNames.empty())
+        return retMap;
+
+    // Write-out the tree hash shell command file
+    // NOTE: The files are hashed in a stable order along with their relative paths
+    auto treeHashFile = FileWriter(_peruFile + ".tree.sh");
+    if (treeHashFile.isOpen())
+    {
+
+        // Write-in the standard Higgs-Boson header for the tree hash file
+        treeHashFile.writeLine("# THIS IS AN AUTOGENERATED FILE USING HIGGS");
+        treeHashFile.writeLine("# DO NOT EDIT (UNLESS YOU KNOW WHAT'S UP)");
+        treeHashFile.writeLine("");
+
+        // Write-in the tree hash of each (existing) module directory
+        treeHashFile.writeLine("# Hash the synced module directories");
+        for (const auto& moduleName : moduleNames)
+        {
+            std::string moduleDir = _peruSyncDir + "/" + moduleName;
+            treeHashFile.writeLine("if [ -d " + moduleDir + " ]; then");
+            treeHashFile.writeLine("    echo \"" + moduleName + " $(cd " + moduleDir
+                    + " && find . -type f -print0 | LC_ALL=C sort -z | xargs -0 -r sha256sum | sha256sum | cut -d' ' -f1)\"");
+            treeHashFile.writeLine("fi");
+        }
+
+        // Close the tree hash file
+        treeHashFile.close();
+
+        // Run the tree hash command and read-in the hashes
+        auto treeHashes = HiggsBoson::RunTypeSingleton::executeInContainerWithResponse(
+                "bash " + _peruFile + ".tree.sh");
+        for (auto treeHash : Utils::splitStringByDelimiter(treeHashes, '\n'))
+        {
+            auto parts = Utils::splitStringByDelimiter(Utils::trim(treeHash), ' ');
+            if ((parts.size() == 2) && (std::find(moduleNames.begin(), moduleNames.end(), parts[0]) != moduleNames.end()))
+                retMap[parts[0]] = parts[1];
+        }
+    }
+
+    // Return the return map
+    return retMap;
+}
@@ -22,7 +22,9 @@
 #ifndef HIGGS_BOSON_PERU_SETTINGS_H
 #define HIGGS_BOSON_PERU_SETTINGS_H
 
+#include <map>
 #include <string>
+#include <vector>
 #include <unordered_map>
 
 namespace BitBoson
@@ -43,6 +45,11 @@ namespace BitBoson
         private:
             std::string _peruFile;
             std::string _peruSyncDir;
+            bool _nativeDownloads;
+            unsigned int _downloadJobs;
+            unsigned int _downloadRetries;
+            std::string _sourceCacheDir;
+            bool _offline;
             std::unordered_map<std::string,
                     std::unordered_map<std::string, std::string>> _dependencies;
 
@@ -59,6 +66,28 @@ namespace BitBoson
              */
             PeruSettings(const std::string& peruFile, const std::string& peruSyncDir);
 
+            /**
+             * Function used to set whether git/curl modules are downloaded natively (shallow
+             * and concurrently) rather than through Peru
+             * NOTE: Checksummed, sparse, and partial modules are always downloaded natively
+             *
+             * @param nativeDownloads Boolean indicating whether to download git/curl modules natively
+             * @param parallelJobs Unsigned Integer representing the number of concurrent downloads
+             * @param retries Unsigned Integer representing the number of download attempts per module
+             */
+            void setNativeDownloads(bool nativeDownloads, unsigned int parallelJobs=4, unsigned int retries=3);
+
+            /**
+             * Function used to set the (content-addressed) source cache shared across projects
+             * NOTE: Peru-synced modules use a shared Peru cache within the source cache (and
+             *       store pinned git modules in it for the native downloader), while all
+             *       modules are resolved natively from the source cache when offline
+             *
+             * @param sourceCacheDir String representing the source cache directory (empty to disable)
+             * @param offline Boolean indicating whether to resolve modules purely from the cache
+             */
+            void setSourceCache(const std::string& sourceCacheDir, bool offline=false);
+
             /**
              * Function used to add a dependency to the Peru settings object
              *
@@ -83,6 +112,8 @@ namespace BitBoson
             /**
              * Function used to perform a Peru-sync operation on the configured
              * location/directory based on the supplied peru sync directory
+             * NOTE: Only modules whose definition or synced files differ from the
+             *       lockfile (".lock" alongside the Peru file) are re-synced
              *
              * @return Boolean indcating whether the Peru sync was performed
              */
@@ -103,6 +134,61 @@ namespace BitBoson
              * @return Boolean indcating whether the Peru file was written
              */
             bool writePeruFile();
+
+            /**
+             * Internal function used to get all of the modules to sync (being the
+             * configured dependencies followed by the built-in integrations)
+             *
+             * @return Map of Strings to Property Maps representing the modules
+             */
+            std::map<std::string, std::map<std::string, std::string>> getModules();
+
+            /**
+             * Internal function used to check whether the given module property is only
+             * understood by the native downloader (and not by Peru)
+             * NOTE: Modules with such properties are always downloaded natively
+             *
+             * @param property String representing the module property to check
+             * @return Boolean indicating whether the property is native-only
+             */
+            static bool isNativeOnlyProperty(const std::string& property);
+
+            /**
+             * Internal function used to get the (content-addressed) source cache directory
+             * of the given module, as used by the native downloader
+             * NOTE: Only git modules pinned to a revision (without any other properties
+             *       which would change their synced files) are cached
+             *
+             * @param properties Map of Strings to Strings representing the module's type and properties
+             * @return String representing the module's source cache directory (empty if not cached)
+             */
+            std::string getSourceCacheDir(const std::map<std::string, std::string>& properties);
+
+            /**
+             * Internal function used to read-in the modules recorded in the lockfile
+             * NOTE: The synced tree hash is recorded as the "tree" property
+             *
+             * @return Map of Strings to Property Maps representing the locked modules
+             */
+            std::map<std::string, std::map<std::string, std::string>> readLockFile();
+
+            /**
+             * Internal function used to write-out the given modules to the lockfile
+             *
+             * @param modules Map of Strings to Property Maps representing the modules to lock
+             * @return Boolean indicating whether the lockfile was written
+             */
+            bool writeLockFile(const std::map<std::string, std::map<std::string, std::string>>& modules);
+
+            /**
+             * Internal function used to get the tree hash (of all file contents) of
+             * the synced directory of each of the given modules
+             * NOTE: Modules without a synced directory are omitted
+             *
+             * @param moduleNames Vector of Strings representing the modules to hash
+             * @return Map of Strings to Strings representing the modules' tree hashes
+             */
+            std::map<std::string, std::string> getTreeHashes(const std::vector<std::string>& moduleNames);
     };
 }
 
@@ -63,9 +63,13 @@ std::string HiggsBoson::getProjectName()
 /**
  * Function used to download the external dependencies for the project
  *
+ * @param sourceCacheDir String representing the source cache directory
+ *                       shared across projects (if any)
+ * @param offline Boolean indicating whether to resolve the dependencies
+ *                purely from the source cache
  * @return Boolean indicating whether the download was successful
  */
-bool HiggsBoson::download()
+bool HiggsBoson::download(const std::string& sourceCacheDir, bool offline)
 {
 
     // Create a return flag
@@ -75,6 +79,7 @@ bool HiggsBoson::download()
     HiggsBoson::RunTypeSingleton::runIdleContainer();
 
     // Call the Peru Download operation and setup the return value
+    _configuration->getPeruSettings()->setSourceCache(sourceCacheDir, offline);
     retFlag = _configuration->getPeruSettings()->peruSync();
 
     // Return the return flag
@@ -147,9 +152,10 @@ bool HiggsBoson::buildDependencies(const std::string& target)
  * Function used to build the project itself for the given target
  *
  * @param target String representing the target to build for
+ * @param profile String representing the build profile to use (if any)
  * @return Boolean indicating whether the build was successful
  */
-bool HiggsBoson::buildProject(const std::string& target)
+bool HiggsBoson::buildProject(const std::string& target, const std::string& profile)
 {
 
     // Create a return flag
@@ -170,17 +176,11 @@ bool HiggsBoson::buildProject(const std::string& target)
         // Remove the corresponding output directory
         HiggsBoson::RunTypeSingleton::executeInContainer("rm -rf " + targetOutputDir);
 
-        // Write-in all of the library dependencies into the CMakeLists.txt file
-        for (const auto& dependency : _configuration->getDependencies())
-            for (const auto& libraryFile : Utils::listFilesInDirectory(targetCacheDir + "/" + dependency->getName()))
-                _configuration->getCMakeSettings()->addLibrary(libraryFile);
-
-        // Write-in all of the header dependencies into the CMakeLists.txt file
-        for (const auto& dependency : _configuration->getDependencies())
-            _configuration->getCMakeSettings()->addIncludeDir(dependency->getHeaderDir(target));
+        // Write-in all of the library and header dependencies into the CMakeLists.txt file
+        addDependenciesToCMake(target);
 
         // Build the main project for the provided target
-        auto buildSuccessfully = _configuration->getCMakeSettings()->buildCMakeProject(target);
+        auto buildSuccessfully = _configuration->getCMakeSettings()->buildCMakeProject(target, profile);
 
         // Only continue if the build operation was successful
         if (buildSuccessfully)
@@ -200,7 +200,8 @@ bool HiggsBoson::buildProject(const std::string& target)
                 packageScript.writeLine("mkdir -p " + targetOutputDir + "/pkg");
 
                 // Copy the output file for the project into the appropriate directory
-                std::string cMakeOutputDir = _cacheDir + "/builds/compile/" + target;
+                std::string cMakeOutputDir = _cacheDir + "/builds/compile/" + target
+                        + (profile.empty() ? "" : ("-" + profile));
                 if (_configuration->getProjectSettings()->getProjectType() == ProjectSettings::ProjectType::TYPE_EXE)
                     packageScript.writeLine("mv " + cMakeOutputDir + "/bin/* " + targetOutputDir + "/bin/");
                 else
@@ -212,7 +213,7 @@ bool HiggsBoson::buildProject(const std::string& target)
                         packageScript.writeLine("cp " + libraryFile + " " + targetOutputDir + "/deps/");
 
                 // Copy plibsys library into the dependency directory as well
-                std::string plibsysLibraryPath = _cacheDir + "/builds/compile/" + target + "/libplibsys";
+                std::string plibsysLibraryPath = cMakeOutputDir + "/libplibsys";
                 packageScript.writeLine("cp " + plibsysLibraryPath + ".so.*" + " " + targetOutputDir + "/deps/");
                 packageScript.writeLine("cp " + plibsysLibraryPath + ".dylib.*" + " " + targetOutputDir + "/deps/");
                 packageScript.writeLine("cp " + plibsysLibraryPath + ".dll" + " " + targetOutputDir + "/deps/");
@@ -242,14 +243,192 @@ bool HiggsBoson::buildProject(const std::string& target)
     return retFlag;
 }
 
+/**
+ * Function used to profile the compile-time of the project for the given target
+ *
+ * @param target String representing the target to build for
+ * @param budgetPath String representing the path to the time budget (if any)
+ * @return Boolean indicating whether the build was successful (and within budget)
+ */
+bool HiggsBoson::profileBuildProject(const std::string& target, const std::string& budgetPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Start the Higgs-Boson builder container
+    HiggsBoson::RunTypeSingleton::runIdleContainer();
+
+    // Only continue if the provided target is a valid one for the project
+    auto validTargets = _configuration->getConfiguredTargets();
+    if(std::find(validTargets.begin(), validTargets.end(), target) != validTargets.end())
+    {
+
+        // Write-in all of the library and header dependencies into the CMakeLists.txt file
+        addDependenciesToCMake(target);
+
+        // Build (and profile) the main project for the provided target
+        retFlag = _configuration->getCMakeSettings()->profileBuildCMakeProject(target, budgetPath);
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to build and run the project's benchmarks
+ *
+ * @param benchFilter String representing the benchmark filter to apply
+ * @param saveBaseline String representing the baseline to save the results as (if any)
+ * @param compareBaseline String representing the baseline to compare against (if any)
+ * @param recordCounters Boolean indicating whether to record the hardware counters
+ * @return Boolean indicating whether the benchmarks were successful
+ */
+bool HiggsBoson::benchProject(const std::string& benchFilter, const std::string& saveBaseline,
+        const std::string& compareBaseline, bool recordCounters)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Start the Higgs-Boson builder container
+    HiggsBoson::RunTypeSingleton::runIdleContainer();
+
+    // Write-in all of the library and header dependencies into the CMakeLists.txt file
+    addDependenciesToCMake("default");
+
+    // Build and run the benchmarks for the main project
+    retFlag = _configuration->getCMakeSettings()->benchCMakeProject(benchFilter,
+            saveBaseline, compareBaseline, recordCounters);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to build the project (default target) using profile-guided
+ * optimization, generating the profile from the training workload first
+ *
+ * @return Boolean indicating whether the build was successful
+ */
+bool HiggsBoson::optimizeProject()
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Start the Higgs-Boson builder container
+    HiggsBoson::RunTypeSingleton::runIdleContainer();
+
+    // Write-in all of the library and header dependencies into the CMakeLists.txt file
+    addDependenciesToCMake("default");
+
+    // Generate the profile and re-build the project (which picks up the cached profile)
+    if (_configuration->getCMakeSettings()->generateOptimizationProfile())
+        retFlag = buildProject("default");
+
+    // Return the return flag
+    return retFlag;
+}
+
 /**
  * Function used to test the project itself for the given test
  *
  * @param testType TestType representing the test to run
  * @param testFilter String representing the test filter to apply
+ * @param parallelJobs Unsigned Integer representing the number of
+ *                     test processes to run concurrently
+ * @param coverageBaseRef String representing the git base reference to limit
+ *                        the coverage report to the changed files (if any)
  * @return Boolean indicating whether the test was successful
  */
-bool HiggsBoson::testProject(CMakeSettings::TestType testType, const std::string& testFilter)
+bool HiggsBoson::testProject(CMakeSettings::TestType testType, const std::string& testFilter,
+        unsigned int parallelJobs, const std::string& coverageBaseRef)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Start the Higgs-Boson builder container
+    HiggsBoson::RunTypeSingleton::runIdleContainer();
+
+    // Write-in all of the library and header dependencies into the CMakeLists.txt file
+    addDependenciesToCMake("default");
+
+    // Test the main project for the provided test-type
+    retFlag = _configuration->getCMakeSettings()->testCMakeProject(testType, testFilter, parallelJobs, coverageBaseRef);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to test the project itself running only the tests affected
+ * by the files changed against the given git base reference
+ *
+ * @param baseRef String representing the git base reference (ie. "origin/main")
+ * @param parallelJobs Unsigned Integer representing the number of
+ *                     test processes to run concurrently
+ * @return Boolean indicating whether the affected tests were successful
+ */
+bool HiggsBoson::testProjectAffected(const std::string& baseRef, unsigned int parallelJobs)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Start the Higgs-Boson builder container
+    HiggsBoson::RunTypeSingleton::runIdleContainer();
+
+    // Write-in all of the library and header dependencies into the CMakeLists.txt file
+    addDependenciesToCMake("default");
+
+    // Test the main project for the affected tests
+    retFlag = _configuration->getCMakeSettings()->testCMakeProjectAffected(baseRef, parallelJobs);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to test the project itself for several tests concurrently
+ *
+ * @param testTypes Vector of TestTypes representing the tests to run
+ * @param testFilter String representing the test filter to apply
+ * @return Boolean indicating whether all of the tests were successful
+ */
+bool HiggsBoson::testProjectMatrix(const std::vector<CMakeSettings::TestType>& testTypes,
+        const std::string& testFilter)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Start the Higgs-Boson builder container
+    HiggsBoson::RunTypeSingleton::runIdleContainer();
+
+    // Write-in all of the library and header dependencies into the CMakeLists.txt file
+    addDependenciesToCMake("default");
+
+    // Test the main project for all of the provided test-types
+    retFlag = _configuration->getCMakeSettings()->testCMakeProjectMatrix(testTypes, testFilter);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to profile the project (default target) running the
+ * given workload under the given profiler
+ *
+ * @param profileType ProfileType representing the profiler to run
+ * @param workloadType String representing the workload type (run, test, or bench)
+ * @param workload String representing the command to run (run) or the
+ *                 test/benchmark filter to apply (test/bench)
+ * @return Boolean indicating whether the profiling was successful
+ */
+bool HiggsBoson::profileProject(CMakeSettings::ProfileType profileType,
+        const std::string& workloadType, const std::string& workload)
 {
 
     // Create a return flag
@@ -258,8 +437,27 @@ bool HiggsBoson::testProject(CMakeSettings::TestType testType, const std::string
     // Start the Higgs-Boson builder container
     HiggsBoson::RunTypeSingleton::runIdleContainer();
 
+    // Write-in all of the library and header dependencies into the CMakeLists.txt file
+    addDependenciesToCMake("default");
+
+    // Profile the main project for the provided profile-type
+    retFlag = _configuration->getCMakeSettings()->profileCMakeProject(profileType, workloadType, workload);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Internal function used to write-in the (built) library and header
+ * dependencies for the given target into the CMakeLists.txt file
+ *
+ * @param target String representing the target to add the dependencies for
+ */
+void HiggsBoson::addDependenciesToCMake(const std::string& target)
+{
+
     // Define the appropriate directories for the target
-    std::string targetCacheDir = _cacheDir + "/output/default";
+    std::string targetCacheDir = _cacheDir + "/output/" + target;
 
     // Write-in all of the library dependencies into the CMakeLists.txt file
     for (const auto& dependency : _configuration->getDependencies())
@@ -268,11 +466,5 @@ bool HiggsBoson::testProject(CMakeSettings::TestType testType, const std::string
 
     // Write-in all of the header dependencies into the CMakeLists.txt file
     for (const auto& dependency : _configuration->getDependencies())
-        _configuration->getCMakeSettings()->addIncludeDir(dependency->getHeaderDir("default"));
-
-    // Test the main project for the provided test-type
-    retFlag = _configuration->getCMakeSettings()->testCMakeProject(testType, testFilter);
-
-    // Return the return flag
-    return retFlag;
+        _configuration->getCMakeSettings()->addIncludeDir(dependency->getHeaderDir(target));
 }
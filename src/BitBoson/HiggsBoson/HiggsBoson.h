@@ -405,9 +405,13 @@ namespace BitBoson
             /**
              * Function used to download the external dependencies for the project
              *
+             * @param sourceCacheDir String representing the source cache directory
+             *                       shared across projects (if any)
+             * @param offline Boolean indicating whether to resolve the dependencies
+             *                purely from the source cache
              * @return Boolean indicating whether the download was successful
              */
-            bool download();
+            bool download(const std::string& sourceCacheDir="", bool offline=false);
 
             /**
              * Function used to build the external dependencies for the project
@@ -421,23 +425,103 @@ namespace BitBoson
              * Function used to build the project itself for the given target
              *
              * @param target String representing the target to build for
+             * @param profile String representing the build profile to use (if any)
              * @return Boolean indicating whether the build was successful
              */
-            bool buildProject(const std::string& target);
+            bool buildProject(const std::string& target, const std::string& profile="");
+
+            /**
+             * Function used to profile the compile-time of the project for the given target
+             *
+             * @param target String representing the target to build for
+             * @param budgetPath String representing the path to the time budget (if any)
+             * @return Boolean indicating whether the build was successful (and within budget)
+             */
+            bool profileBuildProject(const std::string& target, const std::string& budgetPath="");
+
+            /**
+             * Function used to build and run the project's benchmarks
+             *
+             * @param benchFilter String representing the benchmark filter to apply
+             * @param saveBaseline String representing the baseline to save the results as (if any)
+             * @param compareBaseline String representing the baseline to compare against (if any)
+             * @param recordCounters Boolean indicating whether to record the hardware counters
+             * @return Boolean indicating whether the benchmarks were successful
+             */
+            bool benchProject(const std::string& benchFilter="", const std::string& saveBaseline="",
+                    const std::string& compareBaseline="", bool recordCounters=false);
+
+            /**
+             * Function used to build the project (default target) using profile-guided
+             * optimization, generating the profile from the training workload first
+             *
+             * @return Boolean indicating whether the build was successful
+             */
+            bool optimizeProject();
 
             /**
              * Function used to test the project itself for the given test
              *
              * @param testType TestType representing the test to run
              * @param testFilter String representing the test filter to apply
+             * @param parallelJobs Unsigned Integer representing the number of
+             *                     test processes to run concurrently
+             * @param coverageBaseRef String representing the git base reference to limit
+             *                        the coverage report to the changed files (if any)
              * @return Boolean indicating whether the test was successful
              */
-            bool testProject(CMakeSettings::TestType testType, const std::string& testFilter="");
+            bool testProject(CMakeSettings::TestType testType, const std::string& testFilter="",
+                    unsigned int parallelJobs=1, const std::string& coverageBaseRef="");
+
+            /**
+             * Function used to test the project itself running only the tests affected
+             * by the files changed against the given git base reference
+             *
+             * @param baseRef String representing the git base reference (ie. "origin/main")
+             * @param parallelJobs Unsigned Integer representing the number of
+             *                     test processes to run concurrently
+             * @return Boolean indicating whether the affected tests were successful
+             */
+            bool testProjectAffected(const std::string& baseRef, unsigned int parallelJobs=1);
+
+            /**
+             * Function used to test the project itself for several tests concurrently
+             *
+             * @param testTypes Vector of TestTypes representing the tests to run
+             * @param testFilter String representing the test filter to apply
+             * @return Boolean indicating whether all of the tests were successful
+             */
+            bool testProjectMatrix(const std::vector<CMakeSettings::TestType>& testTypes,
+                    const std::string& testFilter="");
+
+            /**
+             * Function used to profile the project (default target) running the
+             * given workload under the given profiler
+             *
+             * @param profileType ProfileType representing the profiler to run
+             * @param workloadType String representing the workload type (run, test, or bench)
+             * @param workload String representing the command to run (run) or the
+             *                 test/benchmark filter to apply (test/bench)
+             * @return Boolean indicating whether the profiling was successful
+             */
+            bool profileProject(CMakeSettings::ProfileType profileType,
+                    const std::string& workloadType="test", const std::string& workload="");
 
             /**
              * Destructor used to cleanup the instance
              */
             virtual ~HiggsBoson() = default;
+
+        // Private member functions
+        private:
+
+            /**
+             * Internal function used to write-in the (built) library and header
+             * dependencies for the given target into the CMakeLists.txt file
+             *
+             * @param target String representing the target to add the dependencies for
+             */
+            void addDependenciesToCMake(const std::string& target);
     };
 }
 
@@ -0,0 +1,282 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
+#include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Utils/CachegrindProfile.h>
+
+using namespace BitBoson;
+
+/**
+ * Internal function used to order the given cache counts by the most
+ * first-level (D1) misses
+ *
+ * @param countsMap Map of Strings to CacheCounts representing the counts to order
+ * @return Vector of CacheCounts representing the ordered counts
+ */
+static std::vector<CachegrindProfile::CacheCounts> getOrderedCounts(
+        const std::map<std::string, CachegrindProfile::CacheCounts>& countsMap)
+{
+
+    // Order the counts by the most first-level misses
+    std::vector<CachegrindProfile::CacheCounts> retVector;
+    for (const auto& counts : countsMap)
+        retVector.push_back(counts.second);
+    std::stable_sort(retVector.begin(), retVector.end(),
+            [](const auto& first, const auto& second) { return first.l1Misses > second.l1Misses; });
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Internal function used to format the given cache counts as a report line
+ *
+ * @param counts CacheCounts representing the counts to format
+ * @return String representing the formatted report line
+ */
+static std::string formatCounts(const CachegrindProfile::CacheCounts& counts)
+{
+
+    // Format the misses (and their ratios against the accesses) followed by the name
+    std::ostringstream countsStream;
+    countsStream << std::fixed << std::setprecision(2)
+            << std::setw(14) << counts.accesses
+            << std::setw(14) << counts.l1Misses << std::setw(9)
+            << ((counts.accesses > 0) ? ((counts.l1Misses * 100.0) / counts.accesses) : 0.0) << "%"
+            << std::setw(14) << counts.llMisses << std::setw(9)
+            << ((counts.accesses > 0) ? ((counts.llMisses * 100.0) / counts.accesses) : 0.0) << "%"
+            << "  " << counts.name;
+
+    // Return the formatted counts
+    return countsStream.str();
+}
+
+/**
+ * Constructor used to setup the (empty) cachegrind profile instance
+ */
+CachegrindProfile::CachegrindProfile()
+{
+
+    // Setup the member variables
+    _totals = CacheCounts{"total", 0, 0, 0};
+}
+
+/**
+ * Function used to read-in (and aggregate) the given cachegrind output
+ * NOTE: The output is expected from "valgrind --tool=cachegrind --cache-sim=yes"
+ *
+ * @param outputPath String representing the path to the cachegrind output
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CachegrindProfile::readCachegrindOutput(const std::string& outputPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the cachegrind output could be opened
+    std::ifstream outputFile(outputPath);
+    if (outputFile.good())
+    {
+
+        // Read-in the cachegrind output
+        readCachegrindOutput(outputFile);
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in (and aggregate) the given cachegrind output
+ *
+ * @param outputStream Input Stream representing the cachegrind output
+ */
+void CachegrindProfile::readCachegrindOutput(std::istream& outputStream)
+{
+
+    // Keep track of the event columns and the current file/function
+    std::unordered_map<std::string, size_t> eventColumns;
+    std::string currentFile = "???";
+    std::string currentFunction = "???";
+
+    // Read-in the output line-by-line
+    std::string line;
+    while (std::getline(outputStream, line))
+    {
+
+        // Handle the event (column) definitions
+        if (line.rfind("events:", 0) == 0)
+        {
+            eventColumns.clear();
+            std::istringstream eventsStream(line.substr(7));
+            std::string eventName;
+            while (eventsStream >> eventName)
+                eventColumns[eventName] = eventColumns.size();
+        }
+
+        // Handle the current file and function changes
+        else if ((line.rfind("fl=", 0) == 0) || (line.rfind("fi=", 0) == 0) || (line.rfind("fe=", 0) == 0))
+            currentFile = line.substr(3);
+        else if (line.rfind("fn=", 0) == 0)
+            currentFunction = line.substr(3);
+
+        // Handle the per-line counts (trailing zero counts may be omitted)
+        else if (!line.empty() && std::isdigit(static_cast<unsigned char>(line[0])))
+        {
+
+            // Read-in the line number and its counts
+            std::istringstream countsStream(line);
+            std::string lineNumber;
+            countsStream >> lineNumber;
+            std::vector<unsigned long long> counts;
+            std::string count;
+            while (countsStream >> count)
+                counts.push_back(std::strtoull(count.c_str(), nullptr, 10));
+
+            // Define the function used to get the count for an event
+            auto getCount = [&](const std::string& eventName)
+            {
+                auto eventColumn = eventColumns.find(eventName);
+                return (((eventColumn != eventColumns.end()) && (eventColumn->second < counts.size()))
+                        ? counts[eventColumn->second] : 0ULL);
+            };
+
+            // Charge the data accesses and misses to the totals, function, and source line
+            auto accesses = getCount("Dr") + getCount("Dw");
+            auto l1Misses = getCount("D1mr") + getCount("D1mw");
+            auto llMisses = getCount("DLmr") + getCount("DLmw");
+            for (auto* cacheCounts : {&_totals, &_functions[currentFunction],
+                    &_sourceLines[currentFile + ":" + lineNumber]})
+            {
+                cacheCounts->accesses += accesses;
+                cacheCounts->l1Misses += l1Misses;
+                cacheCounts->llMisses += llMisses;
+            }
+            _functions[currentFunction].name = currentFunction;
+            _sourceLines[currentFile + ":" + lineNumber].name = currentFile + ":" + lineNumber;
+        }
+    }
+}
+
+/**
+ * Function used to get the total data cache accesses and misses
+ *
+ * @return CacheCounts representing the total accesses and misses
+ */
+CachegrindProfile::CacheCounts CachegrindProfile::getTotals()
+{
+
+    // Simply return the totals
+    return _totals;
+}
+
+/**
+ * Function used to get the data cache accesses and misses of each
+ * function, ordered by the most first-level (D1) misses
+ *
+ * @return Vector of CacheCounts representing the functions
+ */
+std::vector<CachegrindProfile::CacheCounts> CachegrindProfile::getFunctions()
+{
+
+    // Simply return the ordered functions
+    return getOrderedCounts(_functions);
+}
+
+/**
+ * Function used to get the data cache accesses and misses of each
+ * source line ("file:line"), ordered by the most first-level (D1) misses
+ *
+ * @return Vector of CacheCounts representing the source lines
+ */
+std::vector<CachegrindProfile::CacheCounts> CachegrindProfile::getSourceLines()
+{
+
+    // Simply return the ordered source lines
+    return getOrderedCounts(_sourceLines);
+}
+
+/**
+ * Function used to write-out the (top-N) functions and source lines
+ * with their miss ratios as a human-readable report
+ *
+ * @param reportPath String representing the path to write the report to
+ * @param topCount Unsigned Integer representing the number of entries to list
+ * @return Boolean indicating whether the operation was successful
+ */
+bool CachegrindProfile::writeReport(const std::string& reportPath, unsigned int topCount)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Write-out the report
+    auto reportFile = FileWriter(reportPath);
+    if (reportFile.isOpen())
+    {
+
+        // Define the column header used for each of the tables
+        std::ostringstream headerStream;
+        headerStream << std::setw(14) << "Accesses" << std::setw(14) << "D1 Misses" << std::setw(10) << "D1 Miss"
+                << std::setw(14) << "LL Misses" << std::setw(10) << "LL Miss" << "  Name";
+
+        // Write-in the total data cache accesses and misses
+        reportFile.writeLine("Cache Profile (data cache D1/LL simulation)");
+        reportFile.writeLine(headerStream.str());
+        reportFile.writeLine(formatCounts(_totals));
+        reportFile.writeLine("");
+
+        // Write-in the top functions by first-level misses
+        reportFile.writeLine("Top functions by D1 misses:");
+        reportFile.writeLine(headerStream.str());
+        auto functions = getFunctions();
+        for (size_t index = 0; (index < functions.size()) && (index < topCount); index++)
+            reportFile.writeLine(formatCounts(functions[index]));
+        reportFile.writeLine("");
+
+        // Write-in the top source lines by first-level misses
+        reportFile.writeLine("Top source lines by D1 misses:");
+        reportFile.writeLine(headerStream.str());
+        auto sourceLines = getSourceLines();
+        for (size_t index = 0; (index < sourceLines.size()) && (index < topCount); index++)
+            reportFile.writeLine(formatCounts(sourceLines[index]));
+
+        // Close the report file
+        reportFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
@@ -0,0 +1,116 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_CACHEGRIND_PROFILE_H
+#define HIGGS_BOSON_CACHEGRIND_PROFILE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <istream>
+
+namespace BitBoson
+{
+
+    class CachegrindProfile
+    {
+
+        // Public internal structures
+        public:
+            struct CacheCounts
+            {
+                std::string name;
+                unsigned long long accesses;
+                unsigned long long l1Misses;
+                unsigned long long llMisses;
+            };
+
+        // Private member variables
+        private:
+            CacheCounts _totals;
+            std::map<std::string, CacheCounts> _functions;
+            std::map<std::string, CacheCounts> _sourceLines;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (empty) cachegrind profile instance
+             */
+            CachegrindProfile();
+
+            /**
+             * Function used to read-in (and aggregate) the given cachegrind output
+             * NOTE: The output is expected from "valgrind --tool=cachegrind --cache-sim=yes"
+             *
+             * @param outputPath String representing the path to the cachegrind output
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readCachegrindOutput(const std::string& outputPath);
+
+            /**
+             * Function used to read-in (and aggregate) the given cachegrind output
+             *
+             * @param outputStream Input Stream representing the cachegrind output
+             */
+            void readCachegrindOutput(std::istream& outputStream);
+
+            /**
+             * Function used to get the total data cache accesses and misses
+             *
+             * @return CacheCounts representing the total accesses and misses
+             */
+            CacheCounts getTotals();
+
+            /**
+             * Function used to get the data cache accesses and misses of each
+             * function, ordered by the most first-level (D1) misses
+             *
+             * @return Vector of CacheCounts representing the functions
+             */
+            std::vector<CacheCounts> getFunctions();
+
+            /**
+             * Function used to get the data cache accesses and misses of each
+             * source line ("file:line"), ordered by the most first-level (D1) misses
+             *
+             * @return Vector of CacheCounts representing the source lines
+             */
+            std::vector<CacheCounts> getSourceLines();
+
+            /**
+             * Function used to write-out the (top-N) functions and source lines
+             * with their miss ratios as a human-readable report
+             *
+             * @param reportPath String representing the path to write the report to
+             * @param topCount Unsigned Integer representing the number of entries to list
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeReport(const std::string& reportPath, unsigned int topCount=20);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~CachegrindProfile() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_CACHEGRIND_PROFILE_H
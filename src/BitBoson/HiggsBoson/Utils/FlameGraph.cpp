@@ -0,0 +1,456 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <regex>
+#include <vector>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
+#include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Utils/FlameGraph.h>
+
+using namespace BitBoson;
+
+/**
+ * Internal structure used to represent a single (merged) flame graph frame
+ */
+struct GraphFrame
+{
+    std::string name;
+    unsigned int depth;
+    unsigned long long start;
+    unsigned long long end;
+};
+
+/**
+ * Internal function used to escape the given text for use within SVG (XML)
+ *
+ * @param text String representing the text to escape
+ * @return String representing the escaped text
+ */
+static std::string escapeXml(const std::string& text)
+{
+
+    // Create a return string
+    std::string retString;
+
+    // Escape each of the special XML characters
+    for (auto character : text)
+    {
+        if (character == '&')
+            retString += "&amp;";
+        else if (character == '<')
+            retString += "&lt;";
+        else if (character == '>')
+            retString += "&gt;";
+        else if (character == '"')
+            retString += "&quot;";
+        else
+            retString += character;
+    }
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Internal function used to get the (stable) fill color of the given frame
+ *
+ * @param name String representing the name of the frame
+ * @param palette String representing the palette to use ("hot", "io", or "mem")
+ * @return String representing the SVG fill color
+ */
+static std::string getFrameColor(const std::string& name, const std::string& palette)
+{
+
+    // Hash the frame name (FNV-1a) so each frame keeps its color across graphs
+    unsigned long long hash = 14695981039346656037ULL;
+    for (auto character : name)
+        hash = ((hash ^ static_cast<unsigned char>(character)) * 1099511628211ULL);
+    double first = ((hash % 1000) / 1000.0);
+    double second = (((hash / 1000) % 1000) / 1000.0);
+
+    // Pick the color from the palette
+    int red = (205 + static_cast<int>(50 * second));
+    int green = static_cast<int>(230 * first);
+    int blue = static_cast<int>(55 * second);
+    if (palette == "io")
+    {
+        red = (80 + static_cast<int>(60 * first));
+        green = red;
+        blue = (190 + static_cast<int>(55 * second));
+    }
+    else if (palette == "mem")
+    {
+        red = 0;
+        green = (190 + static_cast<int>(50 * second));
+        blue = static_cast<int>(210 * first);
+    }
+
+    // Return the color
+    return "rgb(" + std::to_string(red) + "," + std::to_string(green) + "," + std::to_string(blue) + ")";
+}
+
+/**
+ * Constructor used to setup the (empty) flame graph instance
+ */
+FlameGraph::FlameGraph()
+{
+
+    // Setup the member variables
+    _totalCount = 0;
+}
+
+/**
+ * Function used to add a folded (root-first, semi-colon separated) stack
+ *
+ * @param foldedStack String representing the folded stack
+ * @param count Unsigned Long Long representing the stack's count (samples, time, ...)
+ */
+void FlameGraph::addStack(const std::string& foldedStack, unsigned long long count)
+{
+
+    // Only add non-empty stacks
+    if (!foldedStack.empty() && (count > 0))
+    {
+        _stacks[foldedStack] += count;
+        _totalCount += count;
+    }
+}
+
+/**
+ * Function used to read-in (and aggregate) the given folded stacks
+ * NOTE: Each line is expected as a folded stack followed by its count
+ *
+ * @param foldedPath String representing the path to the folded stacks
+ * @return Boolean indicating whether the operation was successful
+ */
+bool FlameGraph::readFoldedStacks(const std::string& foldedPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the folded stacks could be opened
+    std::ifstream foldedFile(foldedPath);
+    if (foldedFile.good())
+    {
+
+        // Read-in the folded stacks
+        readFoldedStacks(foldedFile);
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in (and aggregate) the given folded stacks
+ *
+ * @param foldedStream Input Stream representing the folded stacks
+ */
+void FlameGraph::readFoldedStacks(std::istream& foldedStream)
+{
+
+    // Read-in each stack with its (trailing) count
+    // NOTE: Frame names may contain spaces so the count is the last field
+    std::string line;
+    while (std::getline(foldedStream, line))
+    {
+        auto countStart = Utils::trim(line).rfind(' ');
+        if (countStart != std::string::npos)
+            addStack(line.substr(0, countStart), std::strtoull(line.substr(countStart + 1).c_str(), nullptr, 10));
+    }
+}
+
+/**
+ * Function used to read-in (and fold) the given sampled perf script output
+ * NOTE: The output is expected from "perf script -F comm,tid,time,event,ip,sym,dso"
+ *       with each sample counting once
+ *
+ * @param scriptPath String representing the path to the perf script output
+ * @return Boolean indicating whether the operation was successful
+ */
+bool FlameGraph::readPerfScript(const std::string& scriptPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the perf script output could be opened
+    std::ifstream scriptFile(scriptPath);
+    if (scriptFile.good())
+    {
+
+        // Read-in the perf script output
+        readPerfScript(scriptFile);
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in (and fold) the given sampled perf script output
+ *
+ * @param scriptStream Input Stream representing the perf script output
+ */
+void FlameGraph::readPerfScript(std::istream& scriptStream)
+{
+
+    // Keep track of the current sample being read-in
+    bool inSample = false;
+    std::string comm;
+    std::vector<std::string> frames;
+
+    // Define the function used to fold the current (leaf-first) sample root-first
+    auto processSample = [&]()
+    {
+        std::string foldedStack = comm;
+        std::replace(foldedStack.begin(), foldedStack.end(), ';', ':');
+        for (auto frame = frames.rbegin(); frame != frames.rend(); frame++)
+            foldedStack += ";" + *frame;
+        addStack(foldedStack, 1);
+        inSample = false;
+        frames.clear();
+    };
+
+    // Read-in the samples line-by-line
+    // NOTE: Each sample is a header line followed by its (leaf-first) frames
+    std::regex headerRegex(R"(^(.*?)\s+(\d+)\s+(\d+)\.(\d+):\s*(.*)$)");
+    std::regex frameRegex(R"(^([0-9a-fA-F]+)\s+(.*)$)");
+    std::string line;
+    while (std::getline(scriptStream, line))
+    {
+
+        // Handle the end of the current sample
+        std::smatch lineMatch;
+        if (Utils::trim(line).empty())
+        {
+            if (inSample)
+                processSample();
+        }
+
+        // Handle the start of a new sample
+        else if (std::regex_match(line, lineMatch, headerRegex))
+        {
+            if (inSample)
+                processSample();
+            comm = lineMatch[1];
+            inSample = true;
+        }
+
+        // Handle the stack frames ("address symbol+offset (dso)") of the current sample
+        // NOTE: Kernel frames are marked as such (like the off-CPU stacks)
+        else if (inSample && std::regex_match(line, lineMatch, frameRegex))
+        {
+            std::string symbol = lineMatch[2];
+            std::string dso;
+            auto dsoStart = symbol.rfind(" (");
+            if ((dsoStart != std::string::npos) && (symbol.back() == ')'))
+            {
+                dso = symbol.substr(dsoStart + 2, symbol.size() - dsoStart - 3);
+                symbol = symbol.substr(0, dsoStart);
+            }
+            auto offsetStart = symbol.rfind("+0x");
+            if (offsetStart != std::string::npos)
+                symbol = symbol.substr(0, offsetStart);
+            std::replace(symbol.begin(), symbol.end(), ';', ':');
+            if (dso.rfind("[kernel", 0) == 0)
+                symbol += "_[k]";
+            frames.push_back(symbol);
+        }
+    }
+
+    // Handle the final sample (if any)
+    if (inSample)
+        processSample();
+}
+
+/**
+ * Function used to get the total count of all of the stacks
+ *
+ * @return Unsigned Long Long representing the total count
+ */
+unsigned long long FlameGraph::getTotalCount()
+{
+
+    // Simply return the total count
+    return _totalCount;
+}
+
+/**
+ * Function used to write-out the stacks in the folded format
+ *
+ * @param foldedPath String representing the path to write the stacks to
+ * @return Boolean indicating whether the operation was successful
+ */
+bool FlameGraph::writeFoldedStacks(const std::string& foldedPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Write-out each of the stacks with their count
+    auto foldedFile = FileWriter(foldedPath);
+    if (foldedFile.isOpen())
+    {
+
+        // Write-in each stack and its count
+        for (const auto& stack : _stacks)
+            foldedFile.writeLine(stack.first + " " + std::to_string(stack.second));
+
+        // Close the folded file
+        foldedFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to write-out the stacks as an SVG flame graph
+ * NOTE: Frames are merged root-first and ordered alphabetically per level
+ *
+ * @param svgPath String representing the path to write the flame graph to
+ * @param title String representing the title of the flame graph
+ * @param countName String representing the name of the counted unit
+ * @param palette String representing the palette to use ("hot", "io", or "mem")
+ * @return Boolean indicating whether the operation was successful
+ */
+bool FlameGraph::writeSvg(const std::string& svgPath, const std::string& title,
+        const std::string& countName, const std::string& palette)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Merge the (alphabetically ordered) stacks into frames, closing the frames
+    // of the previous stack which are not shared with the current one
+    std::vector<GraphFrame> frames;
+    std::vector<GraphFrame> openFrames = {{"all", 0, 0, 0}};
+    unsigned long long position = 0;
+    for (const auto& stack : _stacks)
+    {
+        auto stackFrames = Utils::splitStringByDelimiter(stack.first, ';');
+        size_t sharedFrames = 0;
+        while ((sharedFrames < stackFrames.size()) && ((sharedFrames + 1) < openFrames.size())
+                && (openFrames[sharedFrames + 1].name == stackFrames[sharedFrames]))
+            sharedFrames++;
+        while (openFrames.size() > (sharedFrames + 1))
+        {
+            openFrames.back().end = position;
+            frames.push_back(openFrames.back());
+            openFrames.pop_back();
+        }
+        for (size_t frameIndex = sharedFrames; frameIndex < stackFrames.size(); frameIndex++)
+            openFrames.push_back({stackFrames[frameIndex], static_cast<unsigned int>(frameIndex + 1), position, 0});
+        position += stack.second;
+    }
+    while (!openFrames.empty())
+    {
+        openFrames.back().end = position;
+        frames.push_back(openFrames.back());
+        openFrames.pop_back();
+    }
+
+    // Setup the flame graph dimensions (skipping frames too narrow to be seen)
+    const double imageWidth = 1200;
+    const double frameHeight = 16;
+    const double fontSize = 12;
+    const double fontWidth = 0.59;
+    const double xPad = 10;
+    const double titlePad = (fontSize * 3);
+    const double bottomPad = ((fontSize * 2) + 10);
+    double widthPerCount = ((imageWidth - (2 * xPad)) / static_cast<double>((position > 0) ? position : 1));
+    unsigned int maxDepth = 0;
+    for (const auto& frame : frames)
+        if (((frame.end - frame.start) * widthPerCount) >= 0.1)
+            maxDepth = std::max(maxDepth, frame.depth);
+    double imageHeight = (((maxDepth + 1) * frameHeight) + titlePad + bottomPad);
+
+    // Write-out the flame graph
+    auto svgFile = FileWriter(svgPath);
+    if (svgFile.isOpen())
+    {
+
+        // Write-in the SVG header, background, and title
+        std::ostringstream svgStream;
+        svgStream << std::fixed << std::setprecision(1);
+        svgStream << "<?xml version=\"1.0\" standalone=\"no\"?>\n";
+        svgStream << "<svg version=\"1.1\" width=\"" << imageWidth << "\" height=\"" << imageHeight
+                << "\" viewBox=\"0 0 " << imageWidth << " " << imageHeight
+                << "\" xmlns=\"http://www.w3.org/2000/svg\">\n";
+        svgStream << "<rect x=\"0\" y=\"0\" width=\"" << imageWidth << "\" height=\"" << imageHeight
+                << "\" fill=\"rgb(248,248,248)\"/>\n";
+        svgStream << "<text x=\"" << (imageWidth / 2) << "\" y=\"" << (fontSize * 2) << "\" font-size=\""
+                << (fontSize + 5) << "\" font-family=\"Verdana\" text-anchor=\"middle\">"
+                << escapeXml(title) << "</text>\n";
+
+        // Write-in each (visible) frame with its tooltip and (truncated) label
+        for (const auto& frame : frames)
+        {
+            double width = ((frame.end - frame.start) * widthPerCount);
+            if (width < 0.1)
+                continue;
+            double x = (xPad + (frame.start * widthPerCount));
+            double y = (imageHeight - bottomPad - ((frame.depth + 1) * frameHeight));
+            double percent = ((100.0 * (frame.end - frame.start)) / static_cast<double>((position > 0) ? position : 1));
+            std::ostringstream percentStream;
+            percentStream << std::fixed << std::setprecision(2) << percent;
+            svgStream << "<g><title>" << escapeXml(frame.name) << " (" << (frame.end - frame.start) << " "
+                    << escapeXml(countName) << ", " << percentStream.str() << "%)</title>";
+            svgStream << "<rect x=\"" << x << "\" y=\"" << y << "\" width=\"" << width << "\" height=\""
+                    << (frameHeight - 1) << "\" fill=\"" << getFrameColor(frame.name, palette) << "\" rx=\"2\" ry=\"2\"/>";
+            auto labelChars = static_cast<size_t>(width / (fontSize * fontWidth));
+            if (labelChars >= 3)
+            {
+                std::string label = ((frame.name.size() > labelChars)
+                        ? (frame.name.substr(0, labelChars - 2) + "..") : frame.name);
+                svgStream << "<text x=\"" << (x + 3) << "\" y=\"" << (y + frameHeight - 5) << "\" font-size=\""
+                        << fontSize << "\" font-family=\"Verdana\">" << escapeXml(label) << "</text>";
+            }
+            svgStream << "</g>\n";
+        }
+        svgStream << "</svg>";
+
+        // Write-in the SVG and close the flame graph file
+        svgFile.writeLine(svgStream.str());
+        svgFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
@@ -0,0 +1,124 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_FLAME_GRAPH_H
+#define HIGGS_BOSON_FLAME_GRAPH_H
+
+#include <map>
+#include <string>
+#include <istream>
+
+namespace BitBoson
+{
+
+    class FlameGraph
+    {
+
+        // Private member variables
+        private:
+            unsigned long long _totalCount;
+            std::map<std::string, unsigned long long> _stacks;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (empty) flame graph instance
+             */
+            FlameGraph();
+
+            /**
+             * Function used to add a folded (root-first, semi-colon separated) stack
+             *
+             * @param foldedStack String representing the folded stack
+             * @param count Unsigned Long Long representing the stack's count (samples, time, ...)
+             */
+            void addStack(const std::string& foldedStack, unsigned long long count);
+
+            /**
+             * Function used to read-in (and aggregate) the given folded stacks
+             * NOTE: Each line is expected as a folded stack followed by its count
+             *
+             * @param foldedPath String representing the path to the folded stacks
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readFoldedStacks(const std::string& foldedPath);
+
+            /**
+             * Function used to read-in (and aggregate) the given folded stacks
+             *
+             * @param foldedStream Input Stream representing the folded stacks
+             */
+            void readFoldedStacks(std::istream& foldedStream);
+
+            /**
+             * Function used to read-in (and fold) the given sampled perf script output
+             * NOTE: The output is expected from "perf script -F comm,tid,time,event,ip,sym,dso"
+             *       with each sample counting once
+             *
+             * @param scriptPath String representing the path to the perf script output
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readPerfScript(const std::string& scriptPath);
+
+            /**
+             * Function used to read-in (and fold) the given sampled perf script output
+             *
+             * @param scriptStream Input Stream representing the perf script output
+             */
+            void readPerfScript(std::istream& scriptStream);
+
+            /**
+             * Function used to get the total count of all of the stacks
+             *
+             * @return Unsigned Long Long representing the total count
+             */
+            unsigned long long getTotalCount();
+
+            /**
+             * Function used to write-out the stacks in the folded format
+             *
+             * @param foldedPath String representing the path to write the stacks to
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeFoldedStacks(const std::string& foldedPath);
+
+            /**
+             * Function used to write-out the stacks as an SVG flame graph
+             * NOTE: Frames are merged root-first and ordered alphabetically per level
+             *
+             * @param svgPath String representing the path to write the flame graph to
+             * @param title String representing the title of the flame graph
+             * @param countName String representing the name of the counted unit
+             * @param palette String representing the palette to use ("hot", "io", or "mem")
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeSvg(const std::string& svgPath, const std::string& title,
+                    const std::string& countName="samples", const std::string& palette="hot");
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~FlameGraph() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_FLAME_GRAPH_H
@@ -0,0 +1,254 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <set>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <BitBoson/HiggsBoson/Utils/IncludeGraph.h>
+
+using namespace BitBoson;
+
+/**
+ * Internal function used to (lexically) normalize the given path by
+ * collapsing any "." and ".." components
+ *
+ * @param path String representing the path to normalize
+ * @return String representing the normalized path
+ */
+static std::string normalizePath(const std::string& path)
+{
+
+    // Collapse the path components
+    std::vector<std::string> components;
+    std::stringstream pathStream(path);
+    std::string component;
+    while (std::getline(pathStream, component, '/'))
+    {
+        if (component.empty() || (component == "."))
+            continue;
+        if ((component == "..") && !components.empty() && (components.back() != ".."))
+            components.pop_back();
+        else
+            components.push_back(component);
+    }
+
+    // Re-join the path components
+    std::string retString = ((!path.empty() && (path.front() == '/')) ? "/" : "");
+    for (size_t ii = 0; ii < components.size(); ii++)
+        retString += ((ii > 0) ? "/" : "") + components[ii];
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Constructor used to setup the (empty) include graph instance
+ */
+IncludeGraph::IncludeGraph() = default;
+
+/**
+ * Function used to add an include directory used to resolve the includes
+ * NOTE: Includes which cannot be resolved (ie. system headers) are skipped
+ *
+ * @param includeDir String representing the include directory to add
+ */
+void IncludeGraph::addIncludeDir(const std::string& includeDir)
+{
+
+    // Add the include directory (if not already added)
+    auto normalizedDir = normalizePath(includeDir);
+    if (std::find(_includeDirs.begin(), _includeDirs.end(), normalizedDir) == _includeDirs.end())
+        _includeDirs.push_back(normalizedDir);
+}
+
+/**
+ * Function used to add the given file (and the files it includes) to the
+ * graph by scanning its "#include" directives
+ *
+ * @param filePath String representing the path to the file to add
+ * @return Boolean indicating whether the operation was successful
+ */
+bool IncludeGraph::addFile(const std::string& filePath)
+{
+
+    // Create a return flag (indicating whether the file is part of the graph)
+    auto normalizedPath = normalizePath(filePath);
+    bool retFlag = ((_includes.find(normalizedPath) != _includes.end())
+            || std::ifstream(normalizedPath).good());
+
+    // Scan the file and (iteratively) the files it includes
+    std::vector<std::string> pendingFiles = {normalizedPath};
+    while (!pendingFiles.empty())
+    {
+
+        // Skip files which were already scanned
+        auto currentFile = pendingFiles.back();
+        pendingFiles.pop_back();
+        if (_includes.find(currentFile) != _includes.end())
+            continue;
+
+        // Only continue if the file could be opened
+        std::ifstream fileStream(currentFile);
+        if (!fileStream.good())
+            continue;
+
+        // Handle lines of the form "#include <header>" or "#include "header""
+        auto& fileIncludes = _includes[currentFile];
+        auto currentDir = currentFile.substr(0, currentFile.find_last_of('/') + 1);
+        std::string line;
+        while (std::getline(fileStream, line))
+        {
+
+            // Extract the included path (and whether it was quoted)
+            auto pos = line.find_first_not_of(" \t");
+            if ((pos == std::string::npos) || (line[pos] != '#'))
+                continue;
+            pos = line.find_first_not_of(" \t", pos + 1);
+            if ((pos == std::string::npos) || (line.compare(pos, 7, "include") != 0))
+                continue;
+            pos = line.find_first_not_of(" \t", pos + 7);
+            if ((pos == std::string::npos) || ((line[pos] != '<') && (line[pos] != '"')))
+                continue;
+            auto endPos = line.find(((line[pos] == '<') ? '>' : '"'), pos + 1);
+            if (endPos == std::string::npos)
+                continue;
+            auto includePath = line.substr(pos + 1, endPos - pos - 1);
+
+            // Resolve the include relative to the including file (quoted only)
+            // and then against the include directories
+            std::vector<std::string> candidates;
+            if (line[pos] == '"')
+                candidates.push_back(currentDir + includePath);
+            for (const auto& includeDir : _includeDirs)
+                candidates.push_back(includeDir + "/" + includePath);
+            for (const auto& candidate : candidates)
+            {
+                if (std::ifstream(candidate).good())
+                {
+                    auto resolvedFile = normalizePath(candidate);
+                    fileIncludes.push_back(resolvedFile);
+                    pendingFiles.push_back(resolvedFile);
+                    break;
+                }
+            }
+        }
+        std::sort(fileIncludes.begin(), fileIncludes.end());
+        fileIncludes.erase(std::unique(fileIncludes.begin(), fileIncludes.end()), fileIncludes.end());
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to get the (resolved) files directly included by the given file
+ *
+ * @param filePath String representing the path to the including file
+ * @return Vector of Strings representing the (sorted) included files
+ */
+std::vector<std::string> IncludeGraph::getIncludes(const std::string& filePath)
+{
+
+    // Setup the return vector
+    std::vector<std::string> retVector;
+
+    // Get the direct includes (if the file is part of the graph)
+    auto fileIncludes = _includes.find(normalizePath(filePath));
+    if (fileIncludes != _includes.end())
+        retVector = fileIncludes->second;
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Function used to get the files transitively included by the given file
+ *
+ * @param filePath String representing the path to the including file
+ * @return Vector of Strings representing the (sorted) included files
+ */
+std::vector<std::string> IncludeGraph::getDependencies(const std::string& filePath)
+{
+
+    // Walk the includes (guarding against include cycles)
+    std::set<std::string> dependencies;
+    std::vector<std::string> pendingFiles = getIncludes(filePath);
+    while (!pendingFiles.empty())
+    {
+        auto currentFile = pendingFiles.back();
+        pendingFiles.pop_back();
+        if (dependencies.insert(currentFile).second)
+            for (const auto& includedFile : getIncludes(currentFile))
+                pendingFiles.push_back(includedFile);
+    }
+
+    // Return the dependencies
+    return std::vector<std::string>(dependencies.begin(), dependencies.end());
+}
+
+/**
+ * Function used to get the given files affected by the changed files, being
+ * the files which changed themselves or (transitively) include a changed file
+ * NOTE: A changed source file is treated as changing its headers (same stem)
+ *
+ * @param files Vector of Strings representing the files to check
+ * @param changedFiles Vector of Strings representing the changed files
+ * @return Vector of Strings representing the (sorted) affected files
+ */
+std::vector<std::string> IncludeGraph::getAffectedFiles(const std::vector<std::string>& files,
+        const std::vector<std::string>& changedFiles)
+{
+
+    // Setup the return vector
+    std::vector<std::string> retVector;
+
+    // Gather the changed files (and the headers of any changed source files)
+    std::set<std::string> changedSet;
+    for (const auto& changedFile : changedFiles)
+    {
+        auto normalizedFile = normalizePath(changedFile);
+        changedSet.insert(normalizedFile);
+        auto extensionPos = normalizedFile.find_last_of('.');
+        if ((extensionPos != std::string::npos) && (normalizedFile.find('/', extensionPos) == std::string::npos))
+        {
+            auto extension = normalizedFile.substr(extensionPos + 1);
+            if ((extension == "c") || (extension == "cc") || (extension == "cpp") || (extension == "cxx"))
+                for (const auto& headerExtension : {".h", ".hh", ".hpp", ".hxx"})
+                    changedSet.insert(normalizedFile.substr(0, extensionPos) + headerExtension);
+        }
+    }
+
+    // Keep the files which changed or include a changed file
+    for (const auto& file : files)
+    {
+        addFile(file);
+        bool isAffected = (changedSet.find(normalizePath(file)) != changedSet.end());
+        for (const auto& dependency : getDependencies(file))
+            isAffected = (isAffected || (changedSet.find(dependency) != changedSet.end()));
+        if (isAffected)
+            retVector.push_back(normalizePath(file));
+    }
+    std::sort(retVector.begin(), retVector.end());
+
+    // Return the return vector
+    return retVector;
+}
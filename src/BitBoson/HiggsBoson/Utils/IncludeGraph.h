@@ -0,0 +1,100 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_INCLUDE_GRAPH_H
+#define HIGGS_BOSON_INCLUDE_GRAPH_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace BitBoson
+{
+
+    class IncludeGraph
+    {
+
+        // Private member variables
+        private:
+            std::vector<std::string> _includeDirs;
+            std::map<std::string, std::vector<std::string>> _includes;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (empty) include graph instance
+             */
+            IncludeGraph();
+
+            /**
+             * Function used to add an include directory used to resolve the includes
+             * NOTE: Includes which cannot be resolved (ie. system headers) are skipped
+             *
+             * @param includeDir String representing the include directory to add
+             */
+            void addIncludeDir(const std::string& includeDir);
+
+            /**
+             * Function used to add the given file (and the files it includes) to the
+             * graph by scanning its "#include" directives
+             *
+             * @param filePath String representing the path to the file to add
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool addFile(const std::string& filePath);
+
+            /**
+             * Function used to get the (resolved) files directly included by the given file
+             *
+             * @param filePath String representing the path to the including file
+             * @return Vector of Strings representing the (sorted) included files
+             */
+            std::vector<std::string> getIncludes(const std::string& filePath);
+
+            /**
+             * Function used to get the files transitively included by the given file
+             *
+             * @param filePath String representing the path to the including file
+             * @return Vector of Strings representing the (sorted) included files
+             */
+            std::vector<std::string> getDependencies(const std::string& filePath);
+
+            /**
+             * Function used to get the given files affected by the changed files, being
+             * the files which changed themselves or (transitively) include a changed file
+             * NOTE: A changed source file is treated as changing its headers (same stem)
+             *
+             * @param files Vector of Strings representing the files to check
+             * @param changedFiles Vector of Strings representing the changed files
+             * @return Vector of Strings representing the (sorted) affected files
+             */
+            std::vector<std::string> getAffectedFiles(const std::vector<std::string>& files,
+                    const std::vector<std::string>& changedFiles);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~IncludeGraph() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_INCLUDE_GRAPH_H
@@ -0,0 +1,464 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <regex>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+#include <unordered_map>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
+#include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Utils/OffCpuProfile.h>
+
+using namespace BitBoson;
+
+/**
+ * Internal structure used to represent a single (perf script) stack frame
+ */
+struct StackFrame
+{
+    std::string symbol;
+    std::string dso;
+};
+
+/**
+ * Internal function used to get the value of a "name=value" field from
+ * the given tracepoint output
+ *
+ * @param trace String representing the tracepoint output
+ * @param fieldName String representing the name of the field to get
+ * @return String representing the field's value (empty if not found)
+ */
+static std::string getTraceField(const std::string& trace, const std::string& fieldName)
+{
+
+    // Create a return value
+    std::string retVal;
+
+    // Find the (space separated) field and read-in its value
+    std::istringstream traceStream(trace);
+    std::string token;
+    while (traceStream >> token)
+    {
+        if (token.rfind(fieldName + "=", 0) == 0)
+        {
+            retVal = token.substr(fieldName.size() + 1);
+            break;
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Internal function used to get the folded (root-first, semi-colon separated)
+ * representation of the given (leaf-first) stack frames
+ *
+ * @param comm String representing the command (thread) name used as the root
+ * @param frames Vector of StackFrames representing the (leaf-first) frames
+ * @return String representing the folded stack
+ */
+static std::string getFoldedStack(const std::string& comm, const std::vector<StackFrame>& frames)
+{
+
+    // Start the stack with the command name
+    std::string retString = comm;
+    std::replace(retString.begin(), retString.end(), ';', ':');
+
+    // Add-in the frames (root-first) marking the kernel frames as such
+    for (auto frame = frames.rbegin(); frame != frames.rend(); frame++)
+    {
+        std::string frameName = frame->symbol;
+        std::replace(frameName.begin(), frameName.end(), ';', ':');
+        if (frame->dso.rfind("[kernel", 0) == 0)
+            frameName += "_[k]";
+        retString += ";" + frameName;
+    }
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Internal function used to get the call site of the given (leaf-first) stack
+ * frames, being the innermost frame outside of the kernel and system libraries
+ *
+ * @param frames Vector of StackFrames representing the (leaf-first) frames
+ * @return String representing the call site
+ */
+static std::string getCallSite(const std::vector<StackFrame>& frames)
+{
+
+    // Create a return string
+    std::string retString;
+
+    // Find the innermost frame outside of the kernel and system libraries
+    // NOTE: Falls-back to the innermost user-space frame
+    for (const auto& frame : frames)
+    {
+        if (frame.dso.rfind("[kernel", 0) == 0)
+            continue;
+        if (retString.empty())
+            retString = frame.symbol;
+        auto dsoName = Utils::splitStringByDelimiter(frame.dso, '/').back();
+        if ((dsoName.rfind("libc.", 0) != 0) && (dsoName.rfind("libc-", 0) != 0)
+                && (dsoName.rfind("libpthread", 0) != 0) && (dsoName.rfind("libstdc++", 0) != 0)
+                && (dsoName.rfind("libgcc", 0) != 0) && (dsoName.rfind("ld-linux", 0) != 0))
+        {
+            retString = frame.symbol;
+            break;
+        }
+    }
+
+    // Return the return string
+    return (retString.empty() ? "[unknown]" : retString);
+}
+
+/**
+ * Constructor used to setup the (empty) off-CPU profile instance
+ */
+OffCpuProfile::OffCpuProfile()
+{
+
+    // Setup the member variables
+    _blockedTime = 0;
+}
+
+/**
+ * Function used to read-in (and aggregate) the given perf script output
+ * NOTE: The output is expected from "perf script --ns -F comm,tid,time,
+ *       event,trace,ip,sym,dso" over the sched_switch, sched_stat_sleep,
+ *       sched_stat_blocked, and (enter/exit) futex syscall events
+ *
+ * @param scriptPath String representing the path to the perf script output
+ * @return Boolean indicating whether the operation was successful
+ */
+bool OffCpuProfile::readPerfScript(const std::string& scriptPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the perf script output could be opened
+    std::ifstream scriptFile(scriptPath);
+    if (scriptFile.good())
+    {
+
+        // Read-in the perf script output
+        readPerfScript(scriptFile);
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in (and aggregate) the given perf script output
+ *
+ * @param scriptStream Input Stream representing the perf script output
+ */
+void OffCpuProfile::readPerfScript(std::istream& scriptStream)
+{
+
+    // Keep track of the (per-thread) blocked stacks and futex waits in progress
+    std::unordered_map<std::string, std::string> blockedStacks;
+    std::unordered_map<std::string, std::pair<unsigned long long, std::string>> futexWaits;
+
+    // Keep track of the current sample being read-in
+    std::string comm;
+    std::string tid;
+    std::string event;
+    std::string trace;
+    unsigned long long timestamp = 0;
+    std::vector<StackFrame> frames;
+
+    // Define the function used to aggregate the current sample
+    auto processSample = [&]()
+    {
+
+        // Handle threads being switched-out (voluntarily) by keeping their stacks
+        // NOTE: Preempted (runnable) threads are not blocked so they are ignored
+        if (event == "sched:sched_switch")
+        {
+            auto prevState = getTraceField(trace, "prev_state");
+            if (prevState.empty() || (prevState[0] == 'R'))
+                blockedStacks.erase(tid);
+            else
+                blockedStacks[tid] = getFoldedStack(comm, frames);
+        }
+
+        // Handle threads being woken-up by charging their stacks with the delay
+        // NOTE: These are delivered to the woken thread, but run by the waker
+        else if ((event == "sched:sched_stat_sleep") || (event == "sched:sched_stat_blocked"))
+        {
+            auto pid = getTraceField(trace, "pid");
+            auto blockedStack = blockedStacks.find(pid);
+            if (blockedStack != blockedStacks.end())
+            {
+                auto delay = std::strtoull(getTraceField(trace, "delay").c_str(), nullptr, 10);
+                _blockedStacks[blockedStack->second] += delay;
+                _blockedTime += delay;
+                blockedStacks.erase(blockedStack);
+            }
+        }
+
+        // Handle the start of futex waits (ignoring the wake operations)
+        else if (event == "syscalls:sys_enter_futex")
+        {
+            auto opStart = trace.find("op: ");
+            auto operation = ((opStart == std::string::npos) ? 1
+                    : (std::strtoull(trace.substr(opStart + 4).c_str(), nullptr, 16) & 0x7f));
+            if ((operation == 0) || (operation == 6) || (operation == 9)
+                    || (operation == 11) || (operation == 13))
+                futexWaits[tid] = std::make_pair(timestamp, getCallSite(frames));
+        }
+
+        // Handle the end of futex waits by charging their call sites with the wait
+        else if (event == "syscalls:sys_exit_futex")
+        {
+            auto futexWait = futexWaits.find(tid);
+            if (futexWait != futexWaits.end())
+            {
+                auto& callSite = _futexCallSites[futexWait->second.second];
+                callSite.name = futexWait->second.second;
+                callSite.waitTime += ((timestamp > futexWait->second.first)
+                        ? (timestamp - futexWait->second.first) : 0);
+                callSite.waitCount++;
+                futexWaits.erase(futexWait);
+            }
+        }
+
+        // Reset the current sample
+        event.clear();
+        frames.clear();
+    };
+
+    // Read-in the samples line-by-line
+    // NOTE: Each sample is a header line followed by its (leaf-first) frames
+    std::regex headerRegex(R"(^(.*?)\s+(\d+)\s+(\d+)\.(\d+):\s+(\S+):\s*(.*)$)");
+    std::regex frameRegex(R"(^([0-9a-fA-F]+)\s+(.*)$)");
+    std::string line;
+    while (std::getline(scriptStream, line))
+    {
+
+        // Handle the end of the current sample
+        std::smatch lineMatch;
+        if (Utils::trim(line).empty())
+        {
+            if (!event.empty())
+                processSample();
+        }
+
+        // Handle the start of a new sample
+        else if (std::regex_match(line, lineMatch, headerRegex))
+        {
+            if (!event.empty())
+                processSample();
+            comm = lineMatch[1];
+            tid = lineMatch[2];
+            std::string fraction = lineMatch[4].str().substr(0, 9);
+            fraction.append(9 - fraction.size(), '0');
+            timestamp = (std::strtoull(lineMatch[3].str().c_str(), nullptr, 10) * 1000000000ULL)
+                    + std::strtoull(fraction.c_str(), nullptr, 10);
+            event = lineMatch[5];
+            trace = lineMatch[6];
+        }
+
+        // Handle the stack frames ("address symbol (dso)") of the current sample
+        else if (!event.empty() && std::regex_match(line, lineMatch, frameRegex))
+        {
+            StackFrame frame;
+            frame.symbol = lineMatch[2];
+            auto dsoStart = frame.symbol.rfind(" (");
+            if ((dsoStart != std::string::npos) && (frame.symbol.back() == ')'))
+            {
+                frame.dso = frame.symbol.substr(dsoStart + 2, frame.symbol.size() - dsoStart - 3);
+                frame.symbol = frame.symbol.substr(0, dsoStart);
+            }
+            frames.push_back(frame);
+        }
+    }
+
+    // Handle the final sample (if any)
+    if (!event.empty())
+        processSample();
+}
+
+/**
+ * Function used to get the total time (in nanoseconds) spent blocked
+ *
+ * @return Unsigned Long Long representing the total blocked time
+ */
+unsigned long long OffCpuProfile::getBlockedTime()
+{
+
+    // Simply return the total blocked time
+    return _blockedTime;
+}
+
+/**
+ * Function used to get the blocked time (in nanoseconds) of each folded
+ * (root-first, semi-colon separated) stack, ordered by most blocked time
+ *
+ * @return Vector of String and Unsigned Long Long Pairs representing the stacks
+ */
+std::vector<std::pair<std::string, unsigned long long>> OffCpuProfile::getBlockedStacks()
+{
+
+    // Order the stacks by the most blocked time
+    std::vector<std::pair<std::string, unsigned long long>> retVector(
+            _blockedStacks.begin(), _blockedStacks.end());
+    std::stable_sort(retVector.begin(), retVector.end(),
+            [](const auto& first, const auto& second) { return first.second > second.second; });
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Function used to get the futex (mutex/condition) wait call sites,
+ * being the innermost non-system frames, ordered by most wait time
+ *
+ * @return Vector of CallSites representing the futex wait call sites
+ */
+std::vector<OffCpuProfile::CallSite> OffCpuProfile::getFutexCallSites()
+{
+
+    // Order the call sites by the most wait time
+    std::vector<CallSite> retVector;
+    for (const auto& callSite : _futexCallSites)
+        retVector.push_back(callSite.second);
+    std::stable_sort(retVector.begin(), retVector.end(),
+            [](const auto& first, const auto& second) { return first.waitTime > second.waitTime; });
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Function used to write-out the blocked stacks in the folded format
+ * used for generating flame graphs
+ *
+ * @param foldedPath String representing the path to write the stacks to
+ * @return Boolean indicating whether the operation was successful
+ */
+bool OffCpuProfile::writeFoldedStacks(const std::string& foldedPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Write-out each of the stacks with their blocked time
+    auto foldedFile = FileWriter(foldedPath);
+    if (foldedFile.isOpen())
+    {
+
+        // Write-in each stack and its blocked time (in nanoseconds)
+        for (const auto& blockedStack : _blockedStacks)
+            foldedFile.writeLine(blockedStack.first + " " + std::to_string(blockedStack.second));
+
+        // Close the folded file
+        foldedFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to write-out the (top-N) blocked stacks and futex wait
+ * call sites as a human-readable report
+ *
+ * @param reportPath String representing the path to write the report to
+ * @param topCount Unsigned Integer representing the number of entries to list
+ * @return Boolean indicating whether the operation was successful
+ */
+bool OffCpuProfile::writeReport(const std::string& reportPath, unsigned int topCount)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Define the function used to format nanoseconds as milliseconds
+    auto formatTime = [](unsigned long long nanoseconds)
+    {
+        std::ostringstream timeStream;
+        timeStream << std::fixed << std::setprecision(3) << std::setw(12) << (nanoseconds / 1000000.0) << " ms";
+        return timeStream.str();
+    };
+
+    // Write-out the report
+    auto reportFile = FileWriter(reportPath);
+    if (reportFile.isOpen())
+    {
+
+        // Write-in the total blocked time
+        reportFile.writeLine("Off-CPU Profile");
+        auto blockedTime = formatTime(_blockedTime);
+        reportFile.writeLine("Total blocked time: " + Utils::trim(blockedTime));
+        reportFile.writeLine("");
+
+        // Write-in the top blocked stacks (innermost frames first)
+        reportFile.writeLine("Top blocked stacks:");
+        auto blockedStacks = getBlockedStacks();
+        for (size_t index = 0; (index < blockedStacks.size()) && (index < topCount); index++)
+        {
+            auto frames = Utils::splitStringByDelimiter(blockedStacks[index].first, ';');
+            std::string stackString;
+            for (auto frame = frames.rbegin(); frame != frames.rend(); frame++)
+                stackString += ((stackString.empty() ? "" : " <- ") + *frame);
+            std::ostringstream percentStream;
+            percentStream << std::fixed << std::setprecision(1) << std::setw(6)
+                    << ((_blockedTime > 0) ? ((blockedStacks[index].second * 100.0) / _blockedTime) : 0.0) << "%";
+            reportFile.writeLine(formatTime(blockedStacks[index].second) + " " + percentStream.str() + "  " + stackString);
+        }
+        reportFile.writeLine("");
+
+        // Write-in the top futex wait call sites
+        reportFile.writeLine("Top futex (mutex/condition) wait call sites:");
+        auto futexCallSites = getFutexCallSites();
+        for (size_t index = 0; (index < futexCallSites.size()) && (index < topCount); index++)
+        {
+            std::ostringstream countStream;
+            countStream << std::setw(10) << futexCallSites[index].waitCount << " waits";
+            reportFile.writeLine(formatTime(futexCallSites[index].waitTime) + " "
+                    + countStream.str() + "  " + futexCallSites[index].name);
+        }
+
+        // Close the report file
+        reportFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
@@ -0,0 +1,126 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_OFF_CPU_PROFILE_H
+#define HIGGS_BOSON_OFF_CPU_PROFILE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <istream>
+
+namespace BitBoson
+{
+
+    class OffCpuProfile
+    {
+
+        // Public internal structures
+        public:
+            struct CallSite
+            {
+                std::string name;
+                unsigned long long waitTime;
+                unsigned long long waitCount;
+            };
+
+        // Private member variables
+        private:
+            unsigned long long _blockedTime;
+            std::map<std::string, unsigned long long> _blockedStacks;
+            std::map<std::string, CallSite> _futexCallSites;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (empty) off-CPU profile instance
+             */
+            OffCpuProfile();
+
+            /**
+             * Function used to read-in (and aggregate) the given perf script output
+             * NOTE: The output is expected from "perf script --ns -F comm,tid,time,
+             *       event,trace,ip,sym,dso" over the sched_switch, sched_stat_sleep,
+             *       sched_stat_blocked, and (enter/exit) futex syscall events
+             *
+             * @param scriptPath String representing the path to the perf script output
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readPerfScript(const std::string& scriptPath);
+
+            /**
+             * Function used to read-in (and aggregate) the given perf script output
+             *
+             * @param scriptStream Input Stream representing the perf script output
+             */
+            void readPerfScript(std::istream& scriptStream);
+
+            /**
+             * Function used to get the total time (in nanoseconds) spent blocked
+             *
+             * @return Unsigned Long Long representing the total blocked time
+             */
+            unsigned long long getBlockedTime();
+
+            /**
+             * Function used to get the blocked time (in nanoseconds) of each folded
+             * (root-first, semi-colon separated) stack, ordered by most blocked time
+             *
+             * @return Vector of String and Unsigned Long Long Pairs representing the stacks
+             */
+            std::vector<std::pair<std::string, unsigned long long>> getBlockedStacks();
+
+            /**
+             * Function used to get the futex (mutex/condition) wait call sites,
+             * being the innermost non-system frames, ordered by most wait time
+             *
+             * @return Vector of CallSites representing the futex wait call sites
+             */
+            std::vector<CallSite> getFutexCallSites();
+
+            /**
+             * Function used to write-out the blocked stacks in the folded format
+             * used for generating flame graphs
+             *
+             * @param foldedPath String representing the path to write the stacks to
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeFoldedStacks(const std::string& foldedPath);
+
+            /**
+             * Function used to write-out the (top-N) blocked stacks and futex wait
+             * call sites as a human-readable report
+             *
+             * @param reportPath String representing the path to write the report to
+             * @param topCount Unsigned Integer representing the number of entries to list
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeReport(const std::string& reportPath, unsigned int topCount=20);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~OffCpuProfile() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_OFF_CPU_PROFILE_H
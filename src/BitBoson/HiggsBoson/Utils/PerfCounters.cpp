@@ -0,0 +1,306 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <ctime>
+#include <array>
+#include <cctype>
+#include <vector>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
+#include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Utils/PerfCounters.h>
+
+using namespace BitBoson;
+
+/**
+ * Internal function used to get the events to collect (in metrics column order)
+ *
+ * @return Vector of Strings representing the events to collect
+ */
+static std::vector<std::string> getEventList()
+{
+
+    // Simply return the events to collect
+    return {"cycles", "instructions", "branches", "branch-misses", "L1-dcache-loads",
+            "L1-dcache-load-misses", "LLC-loads", "LLC-load-misses", "context-switches"};
+}
+
+/**
+ * Internal function used to get the derived metrics (name, numerator, and denominator)
+ *
+ * @return Vector of String Arrays representing the derived metrics
+ */
+static std::vector<std::array<std::string, 3>> getDerivedMetrics()
+{
+
+    // Simply return the derived metrics
+    return {{"ipc", "instructions", "cycles"},
+            {"branch-miss-rate", "branch-misses", "branches"},
+            {"L1-dcache-miss-rate", "L1-dcache-load-misses", "L1-dcache-loads"},
+            {"LLC-miss-rate", "LLC-load-misses", "LLC-loads"}};
+}
+
+/**
+ * Function used to get the (comma-separated) hardware and software
+ * events to collect with "perf stat -e"
+ *
+ * @return String representing the events to collect
+ */
+std::string PerfCounters::getEvents()
+{
+
+    // Join the events to collect
+    std::string retString;
+    for (const auto& eventName : getEventList())
+        retString += ((retString.empty() ? "" : ",") + eventName);
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to read-in the given perf stat output
+ * NOTE: The output is expected from "perf stat -x,"
+ *
+ * @param outputPath String representing the path to the perf stat output
+ * @return Boolean indicating whether the operation was successful
+ */
+bool PerfCounters::readPerfStat(const std::string& outputPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the perf stat output could be opened
+    std::ifstream outputFile(outputPath);
+    if (outputFile.good())
+    {
+
+        // Read-in the perf stat output
+        readPerfStat(outputFile);
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in the given perf stat output
+ *
+ * @param outputStream Input Stream representing the perf stat output
+ */
+void PerfCounters::readPerfStat(std::istream& outputStream)
+{
+
+    // Read-in the output line-by-line ("value,unit,event,...")
+    std::string line;
+    while (std::getline(outputStream, line))
+    {
+
+        // Split the line keeping its empty fields (ie. an empty unit)
+        std::string field;
+        std::vector<std::string> fields;
+        std::istringstream lineStream(line);
+        while (std::getline(lineStream, field, ','))
+            fields.push_back(field);
+
+        // Skip comments and the counters which were not supported (or counted)
+        if ((fields.size() < 3) || line.empty() || (line[0] == '#') || fields[0].empty()
+                || !std::isdigit(static_cast<unsigned char>(fields[0][0])))
+            continue;
+
+        // Normalize the event name by removing any PMU (ie. "cpu_core/cycles/")
+        // and modifier (ie. "cycles:u") so hybrid processors are summed together
+        auto eventName = fields[2];
+        if (eventName.find('/') != std::string::npos)
+        {
+            auto eventParts = Utils::splitStringByDelimiter(eventName, '/');
+            eventName = ((eventParts.size() > 1) ? eventParts[1] : eventParts[0]);
+        }
+        eventName = eventName.substr(0, eventName.find(':'));
+
+        // Add the count to the event
+        _counters[eventName] += std::strtoull(fields[0].c_str(), nullptr, 10);
+    }
+}
+
+/**
+ * Function used to get whether the given event was counted
+ *
+ * @param eventName String representing the event (ie. "cycles")
+ * @return Boolean indicating whether the event was counted
+ */
+bool PerfCounters::hasCounter(const std::string& eventName)
+{
+
+    // Simply return whether the event was counted
+    return (_counters.find(eventName) != _counters.end());
+}
+
+/**
+ * Function used to get the count of the given event
+ *
+ * @param eventName String representing the event (ie. "cycles")
+ * @return Unsigned Long Long representing the count (0 if not counted)
+ */
+unsigned long long PerfCounters::getCounter(const std::string& eventName)
+{
+
+    // Simply return the count (if counted)
+    return (hasCounter(eventName) ? _counters[eventName] : 0);
+}
+
+/**
+ * Function used to get the ratio between the two given events
+ * (ie. instructions per cycle or the miss rate of a cache)
+ *
+ * @param numeratorEvent String representing the numerator event
+ * @param denominatorEvent String representing the denominator event
+ * @return Double representing the ratio (0 if either was not counted)
+ */
+double PerfCounters::getRatio(const std::string& numeratorEvent, const std::string& denominatorEvent)
+{
+
+    // Only calculate the ratio if both events were counted
+    double retValue = 0;
+    if (hasCounter(numeratorEvent) && (getCounter(denominatorEvent) > 0))
+        retValue = (static_cast<double>(getCounter(numeratorEvent)) / getCounter(denominatorEvent));
+
+    // Return the return value
+    return retValue;
+}
+
+/**
+ * Function used to get a human-readable summary of the counters
+ * and their derived (IPC and miss rate) metrics
+ *
+ * @return String representing the summary
+ */
+std::string PerfCounters::getSummary()
+{
+
+    // Write-in the counters (marking those that were not counted)
+    std::ostringstream summaryStream;
+    summaryStream << "Hardware Counters:" << std::endl;
+    for (const auto& eventName : getEventList())
+    {
+        summaryStream << "  " << std::left << std::setw(24) << eventName << std::right;
+        if (hasCounter(eventName))
+            summaryStream << std::setw(20) << getCounter(eventName) << std::endl;
+        else
+            summaryStream << std::setw(20) << "not counted" << std::endl;
+    }
+
+    // Write-in the derived metrics (IPC as a ratio and the rest as percentages)
+    summaryStream << std::fixed << std::setprecision(2);
+    for (const auto& derivedMetric : getDerivedMetrics())
+    {
+        summaryStream << "  " << std::left << std::setw(24) << derivedMetric[0] << std::right;
+        if (!hasCounter(derivedMetric[1]) || !hasCounter(derivedMetric[2]))
+            summaryStream << std::setw(20) << "not counted" << std::endl;
+        else if (derivedMetric[0] == "ipc")
+            summaryStream << std::setw(20) << getRatio(derivedMetric[1], derivedMetric[2]) << std::endl;
+        else
+            summaryStream << std::setw(19) << (getRatio(derivedMetric[1], derivedMetric[2]) * 100) << "%" << std::endl;
+    }
+
+    // Return the summary
+    return summaryStream.str();
+}
+
+/**
+ * Function used to append the counters (and their derived metrics)
+ * to the given tab-separated metrics history
+ *
+ * @param metricsPath String representing the path to the metrics history
+ * @param revision String representing the source revision (commit hash)
+ * @return Boolean indicating whether the operation was successful
+ */
+bool PerfCounters::appendMetrics(const std::string& metricsPath, const std::string& revision)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Read-in the existing metrics history (if any)
+    std::string metricsHistory;
+    std::ifstream metricsHistoryFile(metricsPath);
+    if (metricsHistoryFile.good())
+        metricsHistory.assign(std::istreambuf_iterator<char>(metricsHistoryFile), std::istreambuf_iterator<char>());
+    metricsHistoryFile.close();
+
+    // Write-out the metrics history with the new entry appended
+    auto metricsFile = FileWriter(metricsPath);
+    if (metricsFile.isOpen())
+    {
+
+        // Write-in the existing history (or the column header for a new history)
+        if (!metricsHistory.empty())
+            metricsFile.write(metricsHistory);
+        else
+        {
+            metricsFile.write("timestamp\trevision");
+            for (const auto& eventName : getEventList())
+                metricsFile.write("\t" + eventName);
+            for (const auto& derivedMetric : getDerivedMetrics())
+                metricsFile.write("\t" + derivedMetric[0]);
+            metricsFile.writeLine("");
+        }
+
+        // Write-in the new entry (using "-" for the events that were not counted)
+        char timestamp[32];
+        auto currentTime = std::time(nullptr);
+        std::strftime(timestamp, sizeof(timestamp), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&currentTime));
+        std::ostringstream entryStream;
+        entryStream << timestamp << "\t" << revision << std::fixed << std::setprecision(4);
+        for (const auto& eventName : getEventList())
+        {
+            if (hasCounter(eventName))
+                entryStream << "\t" << getCounter(eventName);
+            else
+                entryStream << "\t-";
+        }
+        for (const auto& derivedMetric : getDerivedMetrics())
+        {
+            if (hasCounter(derivedMetric[1]) && hasCounter(derivedMetric[2]))
+                entryStream << "\t" << getRatio(derivedMetric[1], derivedMetric[2]);
+            else
+                entryStream << "\t-";
+        }
+        metricsFile.writeLine(entryStream.str());
+
+        // Close the metrics file
+        metricsFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
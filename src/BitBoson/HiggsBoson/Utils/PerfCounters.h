@@ -0,0 +1,122 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_PERF_COUNTERS_H
+#define HIGGS_BOSON_PERF_COUNTERS_H
+
+#include <map>
+#include <string>
+#include <istream>
+
+namespace BitBoson
+{
+
+    class PerfCounters
+    {
+
+        // Private member variables
+        private:
+            std::map<std::string, unsigned long long> _counters;
+
+        // Public member functions
+        public:
+
+            /**
+             * Function used to get the (comma-separated) hardware and software
+             * events to collect with "perf stat -e"
+             *
+             * @return String representing the events to collect
+             */
+            static std::string getEvents();
+
+            /**
+             * Constructor used to setup the (empty) counters instance
+             */
+            PerfCounters() = default;
+
+            /**
+             * Function used to read-in the given perf stat output
+             * NOTE: The output is expected from "perf stat -x,"
+             *
+             * @param outputPath String representing the path to the perf stat output
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readPerfStat(const std::string& outputPath);
+
+            /**
+             * Function used to read-in the given perf stat output
+             *
+             * @param outputStream Input Stream representing the perf stat output
+             */
+            void readPerfStat(std::istream& outputStream);
+
+            /**
+             * Function used to get whether the given event was counted
+             *
+             * @param eventName String representing the event (ie. "cycles")
+             * @return Boolean indicating whether the event was counted
+             */
+            bool hasCounter(const std::string& eventName);
+
+            /**
+             * Function used to get the count of the given event
+             *
+             * @param eventName String representing the event (ie. "cycles")
+             * @return Unsigned Long Long representing the count (0 if not counted)
+             */
+            unsigned long long getCounter(const std::string& eventName);
+
+            /**
+             * Function used to get the ratio between the two given events
+             * (ie. instructions per cycle or the miss rate of a cache)
+             *
+             * @param numeratorEvent String representing the numerator event
+             * @param denominatorEvent String representing the denominator event
+             * @return Double representing the ratio (0 if either was not counted)
+             */
+            double getRatio(const std::string& numeratorEvent, const std::string& denominatorEvent);
+
+            /**
+             * Function used to get a human-readable summary of the counters
+             * and their derived (IPC and miss rate) metrics
+             *
+             * @return String representing the summary
+             */
+            std::string getSummary();
+
+            /**
+             * Function used to append the counters (and their derived metrics)
+             * to the given tab-separated metrics history
+             *
+             * @param metricsPath String representing the path to the metrics history
+             * @param revision String representing the source revision (commit hash)
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool appendMetrics(const std::string& metricsPath, const std::string& revision);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~PerfCounters() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_PERF_COUNTERS_H
@@ -0,0 +1,523 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+#include <functional>
+#include <fnmatch.h>
+#include <BitBoson/HiggsBoson/Utils/Utils.h>
+#include <BitBoson/HiggsBoson/Utils/FileWriter.h>
+#include <BitBoson/HiggsBoson/Utils/TimeTraceProfile.h>
+
+using namespace BitBoson;
+
+/**
+ * Internal function used to skip the whitespace of the given JSON text
+ *
+ * @param text String representing the JSON text
+ * @param pos Size representing the current position (updated in-place)
+ */
+static void skipJsonWhitespace(const std::string& text, size_t& pos)
+{
+
+    // Simply skip the whitespace characters
+    while ((pos < text.size()) && std::isspace(static_cast<unsigned char>(text[pos])))
+        pos++;
+}
+
+/**
+ * Internal function used to parse the JSON string at the given position
+ * NOTE: Escaped non-ASCII characters are replaced with "?"
+ *
+ * @param text String representing the JSON text
+ * @param pos Size representing the current position (updated in-place)
+ * @param value String representing the parsed string (output)
+ * @return Boolean indicating whether the string was valid
+ */
+static bool parseJsonString(const std::string& text, size_t& pos, std::string& value)
+{
+
+    // Only continue if this is the start of a string
+    if ((pos >= text.size()) || (text[pos] != '"'))
+        return false;
+
+    // Read-in the string (handling the escaped characters)
+    value.clear();
+    for (pos++; pos < text.size(); pos++)
+    {
+        if (text[pos] == '"')
+        {
+            pos++;
+            return true;
+        }
+        else if ((text[pos] == '\\') && ((pos + 1) < text.size()))
+        {
+            char escaped = text[++pos];
+            switch (escaped)
+            {
+                case 'n': value += '\n'; break;
+                case 't': value += '\t'; break;
+                case 'r': value += '\r'; break;
+                case 'b': value += '\b'; break;
+                case 'f': value += '\f'; break;
+                case 'u':
+                {
+                    auto codePoint = std::strtoul(text.substr(pos + 1, 4).c_str(), nullptr, 16);
+                    value += ((codePoint < 0x80) ? static_cast<char>(codePoint) : '?');
+                    pos += 4;
+                    break;
+                }
+                default: value += escaped;
+            }
+        }
+        else
+            value += text[pos];
+    }
+
+    // If we get here, the string was never terminated
+    return false;
+}
+
+/**
+ * Internal function used to parse the JSON value at the given position, flattening
+ * its scalars into the fields (ie. "args.detail") and handing each of the
+ * "traceEvents" array's objects to the event handler
+ *
+ * @param text String representing the JSON text
+ * @param pos Size representing the current position (updated in-place)
+ * @param path String representing the (flattened) path of the value
+ * @param fields Map of Strings to Strings representing the flattened scalars (output)
+ * @param eventHandler Function representing the handler of each trace event
+ * @return Boolean indicating whether the value was valid
+ */
+static bool parseJsonValue(const std::string& text, size_t& pos, const std::string& path,
+        std::map<std::string, std::string>& fields,
+        const std::function<void(std::map<std::string, std::string>&)>& eventHandler)
+{
+
+    // Handle the value based on its first character
+    skipJsonWhitespace(text, pos);
+    if (pos >= text.size())
+        return false;
+
+    // Handle the object values (flattening their keys)
+    if (text[pos] == '{')
+    {
+        pos++;
+        skipJsonWhitespace(text, pos);
+        if ((pos < text.size()) && (text[pos] == '}'))
+        {
+            pos++;
+            return true;
+        }
+        while (pos < text.size())
+        {
+            std::string key;
+            skipJsonWhitespace(text, pos);
+            if (!parseJsonString(text, pos, key))
+                return false;
+            skipJsonWhitespace(text, pos);
+            if ((pos >= text.size()) || (text[pos++] != ':'))
+                return false;
+            if (!parseJsonValue(text, pos, (path.empty() ? key : (path + "." + key)), fields, eventHandler))
+                return false;
+            skipJsonWhitespace(text, pos);
+            if ((pos < text.size()) && (text[pos] == ','))
+                pos++;
+            else
+                return ((pos < text.size()) && (text[pos++] == '}'));
+        }
+        return false;
+    }
+
+    // Handle the array values (handing-off each of the trace events)
+    if (text[pos] == '[')
+    {
+        pos++;
+        skipJsonWhitespace(text, pos);
+        if ((pos < text.size()) && (text[pos] == ']'))
+        {
+            pos++;
+            return true;
+        }
+        while (pos < text.size())
+        {
+            if (path == "traceEvents")
+            {
+                std::map<std::string, std::string> eventFields;
+                if (!parseJsonValue(text, pos, "", eventFields, eventHandler))
+                    return false;
+                eventHandler(eventFields);
+            }
+            else if (!parseJsonValue(text, pos, path + "[]", fields, eventHandler))
+                return false;
+            skipJsonWhitespace(text, pos);
+            if ((pos < text.size()) && (text[pos] == ','))
+                pos++;
+            else
+                return ((pos < text.size()) && (text[pos++] == ']'));
+        }
+        return false;
+    }
+
+    // Handle the string values
+    if (text[pos] == '"')
+        return parseJsonString(text, pos, fields[path]);
+
+    // Handle the remaining (number, boolean, and null) values
+    size_t valueStart = pos;
+    while ((pos < text.size()) && (text[pos] != ',') && (text[pos] != '}')
+            && (text[pos] != ']') && !std::isspace(static_cast<unsigned char>(text[pos])))
+        pos++;
+    fields[path] = text.substr(valueStart, pos - valueStart);
+    return (pos > valueStart);
+}
+
+/**
+ * Internal function used to order the given trace entries by the most total time
+ *
+ * @param entriesMap Map of Strings to TraceEntries representing the entries to order
+ * @return Vector of TraceEntries representing the ordered entries
+ */
+static std::vector<TimeTraceProfile::TraceEntry> getOrderedEntries(
+        const std::map<std::string, TimeTraceProfile::TraceEntry>& entriesMap)
+{
+
+    // Order the entries by the most total time
+    std::vector<TimeTraceProfile::TraceEntry> retVector;
+    for (const auto& entry : entriesMap)
+        retVector.push_back(entry.second);
+    std::stable_sort(retVector.begin(), retVector.end(),
+            [](const auto& first, const auto& second) { return first.totalTime > second.totalTime; });
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Function used to read-in (and aggregate) the given translation unit's time-trace
+ * NOTE: The time-trace is expected from clang's "-ftime-trace"
+ *
+ * @param tracePath String representing the path to the time-trace
+ * @param unitName String representing the translation unit's name
+ * @return Boolean indicating whether the operation was successful
+ */
+bool TimeTraceProfile::readTimeTrace(const std::string& tracePath, const std::string& unitName)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the time-trace could be opened
+    std::ifstream traceFile(tracePath);
+    if (traceFile.good())
+        retFlag = readTimeTrace(traceFile, unitName);
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in (and aggregate) the given translation unit's time-trace
+ *
+ * @param traceStream Input Stream representing the time-trace
+ * @param unitName String representing the translation unit's name
+ * @return Boolean indicating whether the time-trace was valid
+ */
+bool TimeTraceProfile::readTimeTrace(std::istream& traceStream, const std::string& unitName)
+{
+
+    // Read-in the whole time-trace (it is typically written as a single line)
+    std::string traceText((std::istreambuf_iterator<char>(traceStream)), std::istreambuf_iterator<char>());
+
+    // Define the handler used to aggregate each of the complete ("X") events (in milliseconds)
+    bool foundEvents = false;
+    double executeTime = 0;
+    UnitEntry unitEntry{unitName, -1, 0, 0};
+    auto eventHandler = [&](std::map<std::string, std::string>& eventFields)
+    {
+
+        // Only handle the complete events
+        foundEvents = true;
+        if (eventFields["ph"] != "X")
+            return;
+        auto eventName = eventFields["name"];
+        auto eventTime = (std::strtod(eventFields["dur"].c_str(), nullptr) / 1000.0);
+        auto eventDetail = eventFields["args.detail"];
+
+        // Charge the event to the translation unit (or header, template, or function)
+        TraceEntry* traceEntry = nullptr;
+        if (eventName == "Total ExecuteCompiler")
+            unitEntry.totalTime = eventTime;
+        else if (eventName == "ExecuteCompiler")
+            executeTime += eventTime;
+        else if (eventName == "Total Frontend")
+            unitEntry.frontendTime = eventTime;
+        else if (eventName == "Total Backend")
+            unitEntry.backendTime = eventTime;
+        else if (eventName == "Source")
+            traceEntry = &_headers[eventDetail];
+        else if ((eventName == "InstantiateClass") || (eventName == "InstantiateFunction"))
+            traceEntry = &_templates[eventDetail];
+        else if ((eventName == "CodeGen Function") || (eventName == "OptFunction"))
+            traceEntry = &_codeGen[eventDetail];
+        if ((traceEntry != nullptr) && !eventDetail.empty())
+        {
+            traceEntry->name = eventDetail;
+            traceEntry->totalTime += eventTime;
+            traceEntry->count++;
+        }
+    };
+
+    // Parse the time-trace and only keep valid translation units
+    // NOTE: The total time falls back to the compiler's execution time
+    std::map<std::string, std::string> traceFields;
+    size_t pos = 0;
+    bool retFlag = (parseJsonValue(traceText, pos, "", traceFields, eventHandler) && foundEvents);
+    if (retFlag)
+    {
+        if (unitEntry.totalTime < 0)
+            unitEntry.totalTime = executeTime;
+        _units[unitName] = unitEntry;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in the given time budget for the translation units
+ * NOTE: Each line is a "<glob> <milliseconds>" rule where the first
+ *       matching rule applies and "#" starts a comment
+ *
+ * @param budgetPath String representing the path to the time budget
+ * @return Boolean indicating whether the operation was successful
+ */
+bool TimeTraceProfile::readBudget(const std::string& budgetPath)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Only continue if the time budget could be opened
+    std::ifstream budgetFile(budgetPath);
+    if (budgetFile.good())
+    {
+
+        // Read-in the time budget
+        readBudget(budgetFile);
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to read-in the given time budget for the translation units
+ *
+ * @param budgetStream Input Stream representing the time budget
+ */
+void TimeTraceProfile::readBudget(std::istream& budgetStream)
+{
+
+    // Read-in the budget rules line-by-line (ignoring comments)
+    std::string line;
+    while (std::getline(budgetStream, line))
+    {
+        std::string pattern;
+        double budgetTime = 0;
+        std::istringstream lineStream(line.substr(0, line.find('#')));
+        if ((lineStream >> pattern >> budgetTime) && (budgetTime > 0))
+            _budgets.emplace_back(pattern, budgetTime);
+    }
+}
+
+/**
+ * Function used to get the translation units, ordered by the most total time
+ *
+ * @return Vector of UnitEntries representing the translation units
+ */
+std::vector<TimeTraceProfile::UnitEntry> TimeTraceProfile::getTranslationUnits()
+{
+
+    // Order the translation units by the most total time
+    std::vector<UnitEntry> retVector;
+    for (const auto& unit : _units)
+        retVector.push_back(unit.second);
+    std::stable_sort(retVector.begin(), retVector.end(),
+            [](const auto& first, const auto& second) { return first.totalTime > second.totalTime; });
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Function used to get the headers, ordered by the most total parse time
+ *
+ * @return Vector of TraceEntries representing the headers
+ */
+std::vector<TimeTraceProfile::TraceEntry> TimeTraceProfile::getHeaders()
+{
+
+    // Simply return the ordered headers
+    return getOrderedEntries(_headers);
+}
+
+/**
+ * Function used to get the template instantiations, ordered by the most total time
+ *
+ * @return Vector of TraceEntries representing the template instantiations
+ */
+std::vector<TimeTraceProfile::TraceEntry> TimeTraceProfile::getTemplates()
+{
+
+    // Simply return the ordered template instantiations
+    return getOrderedEntries(_templates);
+}
+
+/**
+ * Function used to get the code-generated (and optimized) functions,
+ * ordered by the most total time
+ *
+ * @return Vector of TraceEntries representing the functions
+ */
+std::vector<TimeTraceProfile::TraceEntry> TimeTraceProfile::getCodeGen()
+{
+
+    // Simply return the ordered functions
+    return getOrderedEntries(_codeGen);
+}
+
+/**
+ * Function used to get the translation units exceeding their time budget
+ *
+ * @return Vector of Strings representing the budget violations
+ */
+std::vector<std::string> TimeTraceProfile::getBudgetViolations()
+{
+
+    // Check each translation unit against its first matching budget rule
+    std::vector<std::string> retVector;
+    for (const auto& unit : getTranslationUnits())
+    {
+        auto budget = std::find_if(_budgets.begin(), _budgets.end(),
+                [&](const auto& rule) { return (fnmatch(rule.first.c_str(), unit.name.c_str(), 0) == 0); });
+        if ((budget != _budgets.end()) && (unit.totalTime > budget->second))
+        {
+            std::ostringstream violationStream;
+            violationStream << std::fixed << std::setprecision(1) << unit.name << ": "
+                    << unit.totalTime << " ms (budget " << budget->second << " ms for " << budget->first << ")";
+            retVector.push_back(violationStream.str());
+        }
+    }
+
+    // Return the return vector
+    return retVector;
+}
+
+/**
+ * Function used to write-out the (top-N) translation units, headers,
+ * template instantiations, and functions as a human-readable report
+ *
+ * @param reportPath String representing the path to write the report to
+ * @param topCount Unsigned Integer representing the number of entries to list
+ * @return Boolean indicating whether the operation was successful
+ */
+bool TimeTraceProfile::writeReport(const std::string& reportPath, unsigned int topCount)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Write-out the report
+    auto reportFile = FileWriter(reportPath);
+    if (reportFile.isOpen())
+    {
+
+        // Write-in the slowest translation units (with their frontend/backend split)
+        double totalTime = 0;
+        auto units = getTranslationUnits();
+        for (const auto& unit : units)
+            totalTime += unit.totalTime;
+        std::ostringstream summaryStream;
+        summaryStream << std::fixed << std::setprecision(1) << "Translation units: " << units.size()
+                << ", total compile time: " << totalTime << " ms";
+        reportFile.writeLine("Build Time Profile (clang -ftime-trace)");
+        reportFile.writeLine(summaryStream.str());
+        reportFile.writeLine("");
+        reportFile.writeLine("Slowest translation units:");
+        reportFile.writeLine("    Total (ms) Frontend (ms)  Backend (ms)  Name");
+        for (size_t index = 0; (index < units.size()) && (index < topCount); index++)
+        {
+            std::ostringstream unitStream;
+            unitStream << std::fixed << std::setprecision(1) << std::setw(14) << units[index].totalTime
+                    << std::setw(14) << units[index].frontendTime << std::setw(14) << units[index].backendTime
+                    << "  " << units[index].name;
+            reportFile.writeLine(unitStream.str());
+        }
+
+        // Write-in the most costly headers, template instantiations, and functions
+        std::vector<std::pair<std::string, std::vector<TraceEntry>>> sections = {
+                {"Most expensive headers (total parse time):", getHeaders()},
+                {"Most costly template instantiations:", getTemplates()},
+                {"Most costly code generation (functions):", getCodeGen()}};
+        for (const auto& section : sections)
+        {
+            reportFile.writeLine("");
+            reportFile.writeLine(section.first);
+            reportFile.writeLine("    Total (ms)     Count  Name");
+            for (size_t index = 0; (index < section.second.size()) && (index < topCount); index++)
+            {
+                std::ostringstream entryStream;
+                entryStream << std::fixed << std::setprecision(1) << std::setw(14) << section.second[index].totalTime
+                        << std::setw(10) << section.second[index].count << "  " << section.second[index].name;
+                reportFile.writeLine(entryStream.str());
+            }
+        }
+
+        // Write-in the budget violations (if a budget was provided)
+        if (!_budgets.empty())
+        {
+            auto budgetViolations = getBudgetViolations();
+            reportFile.writeLine("");
+            reportFile.writeLine("Budget violations: " + std::to_string(budgetViolations.size()));
+            for (const auto& budgetViolation : budgetViolations)
+                reportFile.writeLine("  " + budgetViolation);
+        }
+
+        // Close the report file
+        reportFile.close();
+
+        // If we get here, mark the operation as successful
+        retFlag = true;
+    }
+
+    // Return the return flag
+    return retFlag;
+}
@@ -0,0 +1,157 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_TIME_TRACE_PROFILE_H
+#define HIGGS_BOSON_TIME_TRACE_PROFILE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include <istream>
+
+namespace BitBoson
+{
+
+    class TimeTraceProfile
+    {
+
+        // Public internal structures
+        public:
+            struct TraceEntry
+            {
+                std::string name;
+                double totalTime;
+                unsigned long count;
+            };
+            struct UnitEntry
+            {
+                std::string name;
+                double totalTime;
+                double frontendTime;
+                double backendTime;
+            };
+
+        // Private member variables
+        private:
+            std::map<std::string, UnitEntry> _units;
+            std::map<std::string, TraceEntry> _headers;
+            std::map<std::string, TraceEntry> _templates;
+            std::map<std::string, TraceEntry> _codeGen;
+            std::vector<std::pair<std::string, double>> _budgets;
+
+        // Public member functions
+        public:
+
+            /**
+             * Constructor used to setup the (empty) time-trace profile instance
+             */
+            TimeTraceProfile() = default;
+
+            /**
+             * Function used to read-in (and aggregate) the given translation unit's time-trace
+             * NOTE: The time-trace is expected from clang's "-ftime-trace"
+             *
+             * @param tracePath String representing the path to the time-trace
+             * @param unitName String representing the translation unit's name
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readTimeTrace(const std::string& tracePath, const std::string& unitName);
+
+            /**
+             * Function used to read-in (and aggregate) the given translation unit's time-trace
+             *
+             * @param traceStream Input Stream representing the time-trace
+             * @param unitName String representing the translation unit's name
+             * @return Boolean indicating whether the time-trace was valid
+             */
+            bool readTimeTrace(std::istream& traceStream, const std::string& unitName);
+
+            /**
+             * Function used to read-in the given time budget for the translation units
+             * NOTE: Each line is a "<glob> <milliseconds>" rule where the first
+             *       matching rule applies and "#" starts a comment
+             *
+             * @param budgetPath String representing the path to the time budget
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool readBudget(const std::string& budgetPath);
+
+            /**
+             * Function used to read-in the given time budget for the translation units
+             *
+             * @param budgetStream Input Stream representing the time budget
+             */
+            void readBudget(std::istream& budgetStream);
+
+            /**
+             * Function used to get the translation units, ordered by the most total time
+             *
+             * @return Vector of UnitEntries representing the translation units
+             */
+            std::vector<UnitEntry> getTranslationUnits();
+
+            /**
+             * Function used to get the headers, ordered by the most total parse time
+             *
+             * @return Vector of TraceEntries representing the headers
+             */
+            std::vector<TraceEntry> getHeaders();
+
+            /**
+             * Function used to get the template instantiations, ordered by the most total time
+             *
+             * @return Vector of TraceEntries representing the template instantiations
+             */
+            std::vector<TraceEntry> getTemplates();
+
+            /**
+             * Function used to get the code-generated (and optimized) functions,
+             * ordered by the most total time
+             *
+             * @return Vector of TraceEntries representing the functions
+             */
+            std::vector<TraceEntry> getCodeGen();
+
+            /**
+             * Function used to get the translation units exceeding their time budget
+             *
+             * @return Vector of Strings representing the budget violations
+             */
+            std::vector<std::string> getBudgetViolations();
+
+            /**
+             * Function used to write-out the (top-N) translation units, headers,
+             * template instantiations, and functions as a human-readable report
+             *
+             * @param reportPath String representing the path to write the report to
+             * @param topCount Unsigned Integer representing the number of entries to list
+             * @return Boolean indicating whether the operation was successful
+             */
+            bool writeReport(const std::string& reportPath, unsigned int topCount=20);
+
+            /**
+             * Destructor used to cleanup the instance
+             */
+            virtual ~TimeTraceProfile() = default;
+    };
+}
+
+#endif //HIGGS_BOSON_TIME_TRACE_PROFILE_H
@@ -20,11 +20,13 @@
  */
 
 #include <cstdio>
+#include <cmath>
 #include <cctype>
 #include <locale>
 #include <memory>
 #include <string>
 #include <array>
+#include <fstream>
 #include <sstream>
 #include <iostream>
 #include <stdlib.h>
@@ -182,6 +184,94 @@ std::string Utils::sha256(const std::string& data)
     return picosha2::bytes_to_hex_string(hash.begin(), hash.end());
 }
 
+/**
+ * Function used to get the (short) git commit hash of the given directory
+ * NOTE: Uncommitted changes are marked with a "-dirty" suffix
+ *
+ * @param dir String representing the directory within the git repository
+ * @return String representing the commit hash ("unknown" if not a git repository)
+ */
+std::string Utils::getSourceRevision(const std::string& dir)
+{
+
+    // Setup the return string
+    std::string retString = "unknown";
+
+    // Get the commit hash and mark any uncommitted changes
+    auto commitHash = ExecShell::exec("git -C " + dir + " rev-parse --short HEAD 2> /dev/null || true");
+    if (!trim(commitHash).empty())
+    {
+        auto localChanges = ExecShell::exec("git -C " + dir + " status --porcelain --untracked-files=no 2> /dev/null || true");
+        retString = (commitHash + (trim(localChanges).empty() ? "" : "-dirty"));
+    }
+
+    // Return the return string
+    return retString;
+}
+
+/**
+ * Function used to check whether the given git reference resolves to a commit
+ *
+ * @param dir String representing the directory within the git repository
+ * @param ref String representing the git reference (ie. "origin/main")
+ * @return Boolean indicating whether the reference resolves to a commit
+ */
+bool Utils::isGitCommit(const std::string& dir, const std::string& ref)
+{
+
+    // Only (single-quotable) references are valid ones
+    if (ref.empty() || (ref.find('\'') != std::string::npos))
+        return false;
+
+    // Verify the reference resolves to a commit (ie. exists and was fetched)
+    return (ExecShell::exec("git -C " + dir + " rev-parse --verify --quiet '" + ref
+            + "^{commit}' > /dev/null 2>&1 && echo valid") == "valid\n");
+}
+
+/**
+ * Function used to get the files within the given directory that changed
+ * against the given git base reference (including uncommitted/new files)
+ * NOTE: Deleted files are skipped as they no longer exist
+ *
+ * @param dir String representing the directory within the git repository
+ * @param baseRef String representing the git base reference (ie. "origin/main")
+ * @param changedFiles Vector of Strings to fill with the (sorted) full paths of the changed files
+ * @return Boolean indicating whether the changes could be determined (a valid base reference)
+ */
+bool Utils::getChangedFiles(const std::string& dir, const std::string& baseRef, std::vector<std::string>& changedFiles)
+{
+
+    // Only continue if the base reference resolves to a commit
+    changedFiles.clear();
+    if (!isGitCommit(dir, baseRef))
+        return false;
+
+    // Get the changed and new (untracked) files relative to the directory
+    // NOTE: The exit status is appended as the last line as errors share the output
+    auto gitOutput = splitStringByDelimiter(ExecShell::exec("cd " + dir + " && git diff --name-only --relative '"
+            + baseRef + "^{commit}' -- . && git ls-files --others --exclude-standard; echo \"$?\""), '\n');
+    if (gitOutput.empty() || (trim(gitOutput.back()) != "0"))
+    {
+        for (size_t lineIndex = 0; (lineIndex + 1) < gitOutput.size(); lineIndex++)
+            std::cout << gitOutput[lineIndex] << std::endl;
+        return false;
+    }
+    gitOutput.pop_back();
+
+    // Keep the (sorted, unique) files that still exist
+    for (auto changedFile : gitOutput)
+    {
+        auto filePath = dir + "/" + trim(changedFile);
+        if (!changedFile.empty() && std::ifstream(filePath).good())
+            changedFiles.push_back(filePath);
+    }
+    std::sort(changedFiles.begin(), changedFiles.end());
+    changedFiles.erase(std::unique(changedFiles.begin(), changedFiles.end()), changedFiles.end());
+
+    // If we get here, the changes were determined successfully
+    return true;
+}
+
 /**
  * Function used to trim the provided string (in-place)
  * NOTE: We also return the string for convenience
@@ -202,3 +292,161 @@ std::string Utils::trim(std::string &stringToTrim)
     // Return the trimmed string
     return stringToTrim;
 }
+
+/**
+ * Function used to extract (and remove) a "--name value" option from the
+ * command-line arguments so the remaining positional arguments are unchanged
+ *
+ * @param argc Integer reference representing the number of command-line arguments
+ * @param argv Character* Array representing the difference command-line arguments
+ * @param optionName String representing the option name (ie. "--parallel")
+ * @return String representing the option's value (empty if not provided)
+ */
+std::string Utils::extractCommandLineOption(int& argc, char* argv[], const std::string& optionName)
+{
+
+    // Create a return value
+    std::string retVal;
+
+    // Find the option (and its value) and shift the remaining arguments down
+    for (int ii = 1; ii < argc; ii++)
+    {
+        if (std::string(argv[ii]) == optionName)
+        {
+            int removeCount = ((ii + 1) < argc) ? 2 : 1;
+            if (removeCount == 2)
+                retVal = std::string(argv[ii + 1]);
+            for (int jj = ii; (jj + removeCount) <= argc; jj++)
+                argv[jj] = argv[jj + removeCount];
+            argc -= removeCount;
+            break;
+        }
+    }
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to extract (and remove) a "--name" flag from the command-line
+ * arguments so the remaining positional arguments are unchanged
+ *
+ * @param argc Integer reference representing the number of command-line arguments
+ * @param argv Character* Array representing the difference command-line arguments
+ * @param flagName String representing the flag name (ie. "--offcpu")
+ * @return Boolean indicating whether the flag was provided
+ */
+bool Utils::extractCommandLineFlag(int& argc, char* argv[], const std::string& flagName)
+{
+
+    // Create a return flag
+    bool retFlag = false;
+
+    // Find the flag and shift the remaining arguments down
+    for (int ii = 1; ii < argc; ii++)
+    {
+        if (std::string(argv[ii]) == flagName)
+        {
+            for (int jj = ii; (jj + 1) <= argc; jj++)
+                argv[jj] = argv[jj + 1];
+            argc -= 1;
+            retFlag = true;
+            break;
+        }
+    }
+
+    // Return the return flag
+    return retFlag;
+}
+
+/**
+ * Function used to join the command-line arguments from the given index onwards
+ * (unchanged) in order to pass them through to another command
+ *
+ * @param argc Integer representing the number of command-line arguments
+ * @param argv Character* Array representing the difference command-line arguments
+ * @param startIndex Integer representing the index of the first argument to join
+ * @return String representing the (space-separated) joined arguments
+ */
+std::string Utils::joinCommandLineArgs(int argc, char* argv[], int startIndex)
+{
+
+    // Create a return value
+    std::string retVal;
+
+    // Collect all of the remaining arguments
+    for (int ii = startIndex; ii < argc; ii++)
+        retVal += (std::string(argv[ii]) + std::string(" "));
+
+    // Return the return value
+    return retVal;
+}
+
+/**
+ * Function used to get the (two-sided) p-value of the Mann-Whitney U test
+ * for whether the two given samples come from the same distribution
+ * NOTE: Uses the normal approximation with tie and continuity corrections
+ *
+ * @param firstSamples Vector of Doubles representing the first samples
+ * @param secondSamples Vector of Doubles representing the second samples
+ * @return Double representing the p-value (1.0 if it cannot be determined)
+ */
+double Utils::mannWhitneyPValue(const std::vector<double>& firstSamples,
+        const std::vector<double>& secondSamples)
+{
+
+    // Create a return value
+    double retValue = 1.0;
+
+    // Only continue if both samples contain values
+    double firstCount = firstSamples.size();
+    double secondCount = secondSamples.size();
+    if ((firstCount > 0) && (secondCount > 0))
+    {
+
+        // Combine and sort the samples (keeping track of which sample each came from)
+        std::vector<std::pair<double, bool>> combinedSamples;
+        for (auto sample : firstSamples)
+            combinedSamples.emplace_back(sample, true);
+        for (auto sample : secondSamples)
+            combinedSamples.emplace_back(sample, false);
+        std::sort(combinedSamples.begin(), combinedSamples.end());
+
+        // Rank the combined samples (averaging the ranks of ties) and sum-up
+        // the first sample's ranks along with the tie correction term
+        double firstRankSum = 0;
+        double tieCorrection = 0;
+        size_t groupStart = 0;
+        while (groupStart < combinedSamples.size())
+        {
+            size_t groupEnd = groupStart + 1;
+            while ((groupEnd < combinedSamples.size())
+                    && (combinedSamples[groupEnd].first == combinedSamples[groupStart].first))
+                groupEnd++;
+            double tieCount = groupEnd - groupStart;
+            double averageRank = (groupStart + 1 + groupEnd) / 2.0;
+            for (size_t index = groupStart; index < groupEnd; index++)
+                if (combinedSamples[index].second)
+                    firstRankSum += averageRank;
+            tieCorrection += (tieCount * tieCount * tieCount) - tieCount;
+            groupStart = groupEnd;
+        }
+
+        // Calculate the U statistic along with its expected mean and deviation
+        double totalCount = firstCount + secondCount;
+        double uStatistic = firstRankSum - ((firstCount * (firstCount + 1)) / 2.0);
+        double uMean = (firstCount * secondCount) / 2.0;
+        double uDeviation = std::sqrt(((firstCount * secondCount) / 12.0)
+                * ((totalCount + 1) - (tieCorrection / (totalCount * (totalCount - 1)))));
+
+        // Calculate the two-sided p-value from the (continuity corrected) z-score
+        if (uDeviation > 0)
+        {
+            double zScore = std::max(0.0, std::fabs(uStatistic - uMean) - 0.5) / uDeviation;
+            retValue = std::min(1.0, std::erfc(zScore / std::sqrt(2.0)));
+        }
+    }
+
+    // Return the return value
+    return retValue;
+}
@@ -61,6 +61,36 @@ namespace BitBoson::Utils
      */
     std::string sha256(const std::string& data);
 
+    /**
+     * Function used to get the (short) git commit hash of the given directory
+     * NOTE: Uncommitted changes are marked with a "-dirty" suffix
+     *
+     * @param dir String representing the directory within the git repository
+     * @return String representing the commit hash ("unknown" if not a git repository)
+     */
+    std::string getSourceRevision(const std::string& dir);
+
+    /**
+     * Function used to check whether the given git reference resolves to a commit
+     *
+     * @param dir String representing the directory within the git repository
+     * @param ref String representing the git reference (ie. "origin/main")
+     * @return Boolean indicating whether the reference resolves to a commit
+     */
+    bool isGitCommit(const std::string& dir, const std::string& ref);
+
+    /**
+     * Function used to get the files within the given directory that changed
+     * against the given git base reference (including uncommitted/new files)
+     * NOTE: Deleted files are skipped as they no longer exist
+     *
+     * @param dir String representing the directory within the git repository
+     * @param baseRef String representing the git base reference (ie. "origin/main")
+     * @param changedFiles Vector of Strings to fill with the (sorted) full paths of the changed files
+     * @return Boolean indicating whether the changes could be determined (a valid base reference)
+     */
+    bool getChangedFiles(const std::string& dir, const std::string& baseRef, std::vector<std::string>& changedFiles);
+
     /**
      * Function used to trim the provided string (in-place)
      * NOTE: We also return the string for convenience
@@ -69,6 +99,51 @@ namespace BitBoson::Utils
      * @return String representing the trimmed string
      */
     std::string trim(std::string &stringToTrim);
+
+    /**
+     * Function used to extract (and remove) a "--name value" option from the
+     * command-line arguments so the remaining positional arguments are unchanged
+     *
+     * @param argc Integer reference representing the number of command-line arguments
+     * @param argv Character* Array representing the difference command-line arguments
+     * @param optionName String representing the option name (ie. "--parallel")
+     * @return String representing the option's value (empty if not provided)
+     */
+    std::string extractCommandLineOption(int& argc, char* argv[], const std::string& optionName);
+
+    /**
+     * Function used to extract (and remove) a "--name" flag from the command-line
+     * arguments so the remaining positional arguments are unchanged
+     *
+     * @param argc Integer reference representing the number of command-line arguments
+     * @param argv Character* Array representing the difference command-line arguments
+     * @param flagName String representing the flag name (ie. "--offcpu")
+     * @return Boolean indicating whether the flag was provided
+     */
+    bool extractCommandLineFlag(int& argc, char* argv[], const std::string& flagName);
+
+    /**
+     * Function used to join the command-line arguments from the given index onwards
+     * (unchanged) in order to pass them through to another command
+     *
+     * @param argc Integer representing the number of command-line arguments
+     * @param argv Character* Array representing the difference command-line arguments
+     * @param startIndex Integer representing the index of the first argument to join
+     * @return String representing the (space-separated) joined arguments
+     */
+    std::string joinCommandLineArgs(int argc, char* argv[], int startIndex);
+
+    /**
+     * Function used to get the (two-sided) p-value of the Mann-Whitney U test
+     * for whether the two given samples come from the same distribution
+     * NOTE: Uses the normal approximation with tie and continuity corrections
+     *
+     * @param firstSamples Vector of Doubles representing the first samples
+     * @param secondSamples Vector of Doubles representing the second samples
+     * @return Double representing the p-value (1.0 if it cannot be determined)
+     */
+    double mannWhitneyPValue(const std::vector<double>& firstSamples,
+            const std::vector<double>& secondSamples);
 }
 
 #endif //HIGGS_BOSON_UTILS_H
@@ -21,17 +21,20 @@
 
 #include <string>
 #include <vector>
+#include <cstdlib>
 #include <signal.h>
 #include <BitBoson/HiggsBoson/HiggsBoson.h>
 #include <BitBoson/HiggsBoson/Utils/Utils.h>
 #include <BitBoson/HiggsBoson/Utils/FileWriter.h>
 #include <BitBoson/HiggsBoson/Utils/ExecShell.h>
 #include <BitBoson/HiggsBoson/Utils/Constants.h>
+#include <BitBoson/HiggsBoson/Utils/PerfCounters.h>
 
 using namespace BitBoson;
 
 // Define some useful "constants" (will be modified)
 std::string HIGGS_BUILDER_NAME = Constants::DOCKER_HIGGS_BUILDER_PREFIX;
+std::string HIGGS_SOURCE_CACHE_DIR = "";
 
 /**
  * Function used to handle a Ctrl-C Interrupt for the application
@@ -198,6 +201,8 @@ std::string setupDockerImage(const std::string& target,
                     + " --rm -w " + projectDir
                     + " --mount type=tmpfs,destination=/ramdisk "
                     + " -v " + dockerSyncVolume + ":" + projectDir
+                    + " -v " + HIGGS_SOURCE_CACHE_DIR + ":" + HIGGS_SOURCE_CACHE_DIR
+                    + " -e HIGGS_BOSON_SOURCES=" + HIGGS_SOURCE_CACHE_DIR
                     + " -t bitboson/higgs-builder \"\\$\\@\"\" > ./bitboson-higgs-builder"
                 + " && chmod +x ./bitboson-higgs-builder");
 
@@ -228,6 +233,8 @@ std::string setupDockerImage(const std::string& target,
                 + (interactive ? " --interactive" : "")
                 + " --rm -w " + projectDir
                 + " -v " + dockerSyncVolume + ":" + projectDir
+                + " -v " + HIGGS_SOURCE_CACHE_DIR + ":" + HIGGS_SOURCE_CACHE_DIR
+                + " -e HIGGS_BOSON_SOURCES=" + HIGGS_SOURCE_CACHE_DIR
                 + " -t bitboson/" + target + " \"\\$\\@\"\" > ./bitboson-" + target
                 + " && chmod +x ./bitboson-" + target);
 
@@ -291,20 +298,33 @@ int main(int argc, char* argv[])
         std::cout << "  list-targets                  List all possible targets supported by higgs-boson" << std::endl;
         std::cout << "  update-builders               Update the builder-containers to the latest version" << std::endl;
         std::cout << "  setup <target> [XCode|local]  Setup cross-compilation support for the provided target" << std::endl;
-        std::cout << "  download [local]              Download all external dependencies (local is outside of docker)" << std::endl;
+        std::cout << "  download [local] [--offline]  Download all external dependencies (local is outside of docker)" << std::endl;
+        std::cout << "                                (offline, resolving them from the source cache of earlier downloads)" << std::endl;
         std::cout << "  build-deps <target*>          Build all external dependencies for a given target" << std::endl;
-        std::cout << "  build <target*>               Build the main project for a given target" << std::endl;
-        std::cout << "  test <filter>                 Run the provided/desired tests (wild-card filter)" << std::endl;
-        std::cout << "  profile <filter>              Run the provided/desired profile tests (wild-card filter)" << std::endl;
+        std::cout << "  build <target*> [--profile P] Build the main project for a given target (and build profile)" << std::endl;
+        std::cout << "  build-profile <target*> [--budget F]" << std::endl;
+        std::cout << "                                Profile the main project's compile-time (checking time budget F)" << std::endl;
+        std::cout << "  pgo                           Build the main project with profile-guided optimization" << std::endl;
+        std::cout << "  test <filter> [--parallel N]  Run the provided/desired tests (wild-card filter)" << std::endl;
+        std::cout << "  test --affected <ref> [--parallel N]" << std::endl;
+        std::cout << "                                Run only the tests affected by the changes against git reference ref" << std::endl;
+        std::cout << "  profile <filter> [--sampler perf|--offcpu|--heap|--cache] [--workload test|bench|run]" << std::endl;
+        std::cout << "                                Run the provided/desired profile tests (results in output/profile)" << std::endl;
+        std::cout << "  bench <filter> [--save B] [--compare B] [--counters]" << std::endl;
+        std::cout << "                                Run the provided/desired benchmarks (saving/comparing baseline B)" << std::endl;
         std::cout << "  debug                         Run the provided/desired tests in debugging mode" << std::endl;
-        std::cout << "  coverage                      Run all tests and produce a code-coverage report (including html)" << std::endl;
-        std::cout << "  sanitize <type**>             Run the provided/desired code sanitizer for code quality" << std::endl;
+        std::cout << "  coverage [--parallel N] [--base REF]" << std::endl;
+        std::cout << "                                Run all tests and produce a code-coverage report (including html)" << std::endl;
+        std::cout << "                                (limited to the source files changed against git reference REF)" << std::endl;
+        std::cout << "  sanitize <type**> [--parallel N]" << std::endl;
+        std::cout << "                                Run the provided/desired code sanitizer for code quality" << std::endl;
         std::cout << "  cli <target*>                 Run an interactive shell on the provided build container" << std::endl;
         std::cout << "  cmd <target*> <options>       Run generic commands (via bash) on the provided build container" << std::endl;
-        std::cout << "  run <additional args>         Run the built executable on the current platform" << std::endl;
+        std::cout << "  run [--counters] <additional args>" << std::endl;
+        std::cout << "                                Run the built executable on the current platform" << std::endl;
         std::cout << std::endl;
         std::cout << "*Possible targets depend on each individual project" << std::endl;
-        std::cout << "**Test/Sanitize types include: address, behavior, thread, and leak" << std::endl;
+        std::cout << "**Test/Sanitize types include: address, behavior, thread, leak, and all (concurrently)" << std::endl;
 
         // Return zero to exit early
         return 0;
@@ -328,8 +348,16 @@ int main(int argc, char* argv[])
             ? (currentPath + "/.higgs-boson")
             : (userHomePath + "/.higgs-boson"));
 
-    // Ensure that the cache directory exists
+    // Define the (content-addressed) source cache shared across projects
+    // NOTE: Nested (internal) runs inherit the source cache of the outer run
+    const char* sourceCacheValue = getenv("HIGGS_BOSON_SOURCES");
+    HIGGS_SOURCE_CACHE_DIR = ((sourceCacheValue != NULL)
+            ? std::string(sourceCacheValue)
+            : (globalCacheDir + "/sources"));
+
+    // Ensure that the cache directories exist
     ExecShell::exec("mkdir -p " + appCacheDir);
+    ExecShell::exec("mkdir -p " + HIGGS_SOURCE_CACHE_DIR);
 
     // Use/setup docker-sync if it is installed (or configured to do so)
     // bool dockerSyncInstalled = (ExecShell::exec("docker-sync --version")
@@ -462,10 +490,8 @@ int main(int argc, char* argv[])
                                   appCacheDir, projectDirHash), HIGGS_BUILDER_NAME);
         HiggsBoson::RunTypeSingleton::runIdleContainer();
 
-        // Collect all remaining arguments to pass to the command
-        std::string commandInfo;
-        for (int ii = (foundTarget ? 3 : 2); ii < argc; ii++)
-            commandInfo += (std::string(argv[ii]) + std::string(" "));
+        // Collect all remaining arguments (unchanged) to pass to the command
+        std::string commandInfo = Utils::joinCommandLineArgs(argc, argv, (foundTarget ? 3 : 2));
 
         // Actually handle the generic command here
         HiggsBoson::RunTypeSingleton::executeInContainer(commandInfo);
@@ -481,17 +507,25 @@ int main(int argc, char* argv[])
     if ((argc > 1) && (std::string(argv[1]) == "run"))
     {
 
-        // Collect all remaining arguments to pass to the run command
-        std::string runArgs;
-        for (int ii = 2; ii < argc; ii++)
-            runArgs += (std::string(argv[ii]) + std::string(" "));
+        // Collect all remaining arguments (unchanged) to pass to the run command
+        // NOTE: Only a leading "--counters" flag is for higgs-boson itself
+        bool recordCounters = ((argc > 2) && (std::string(argv[2]) == "--counters"));
+        std::string runArgs = Utils::joinCommandLineArgs(argc, argv, (recordCounters ? 3 : 2));
+
+        // Define the hardware counter collection (if requested)
+        std::string countersPath = "output/run/counters.csv";
+        std::string countersCommand = ("perf stat -x, -o " + countersPath + " -e " + PerfCounters::getEvents() + " -- ");
+        if (recordCounters)
+            ExecShell::exec("mkdir -p output/run && rm -f " + countersPath);
 
         // Handle the run-command based on the current platform (from pre-processor macros)
+        // NOTE: Hardware counters are only supported on linux (via perf)
         #ifdef HIGGS_BOSON_TARGET_OS
             #if HIGGS_BOSON_TARGET_OS == linux
                 std::string binaryPath = "output/default/bin/" + higgsBoson.getProjectName();
                 std::string dependenciesPath = "output/default/deps";
-                ExecShell::execLive("LD_LIBRARY_PATH=" + dependenciesPath + " ./" + binaryPath + " " + runArgs);
+                ExecShell::execLive("LD_LIBRARY_PATH=" + dependenciesPath + " "
+                        + (recordCounters ? countersCommand : "") + "./" + binaryPath + " " + runArgs);
             #elif HIGGS_BOSON_TARGET_OS == darwin
                 std::string binaryPath = "output/default/bin/" + higgsBoson.getProjectName();
                 std::string dependenciesPath = "output/default/deps";
@@ -503,6 +537,23 @@ int main(int argc, char* argv[])
             #endif
         #endif
 
+        // Report and persist the hardware counters with the commit hash (if requested)
+        if (recordCounters)
+        {
+            PerfCounters perfCounters;
+            std::string metricsPath = appCacheDir + "/metrics/run.tsv";
+            if (!perfCounters.readPerfStat(countersPath))
+            {
+                std::cout << "Hardware counters were not recorded (perf is required on the linux host)" << std::endl;
+                return 1;
+            }
+            ExecShell::exec("mkdir -p " + appCacheDir + "/metrics");
+            std::cout << perfCounters.getSummary();
+            if (!perfCounters.appendMetrics(metricsPath, Utils::getSourceRevision(currentPath)))
+                return 1;
+            std::cout << "Hardware counters appended to " << metricsPath << std::endl;
+        }
+
         // Return zero to exit early
         return 0;
     }
@@ -520,22 +571,25 @@ int main(int argc, char* argv[])
         // Setup a return flag
         bool retFlag = false;
 
+        // Extract the named options of the download command
+        auto downloadOffline = Utils::extractCommandLineFlag(argc, argv, "--offline");
+
         // Handle the default download operation (if applicable)
         if ((argc <= 2) || ((argc > 2) && (std::string(argv[2]) == "default")))
-            retFlag = higgsBoson.download();
+            retFlag = higgsBoson.download(HIGGS_SOURCE_CACHE_DIR, downloadOffline);
 
         // Handle the local download operation (if applicable)
         if ((argc > 2) && (std::string(argv[2]) == "local"))
         {
             HiggsBoson::RunTypeSingleton::setDockerRunCommand("sh");
-            retFlag = higgsBoson.download();
+            retFlag = higgsBoson.download(HIGGS_SOURCE_CACHE_DIR, downloadOffline);
         }
 
         // Handle the internal download operation (if applicable)
         if ((argc > 2) && (std::string(argv[2]) == "internal"))
         {
             HiggsBoson::RunTypeSingleton::setDockerRunCommand("sh");
-            retFlag = higgsBoson.download();
+            retFlag = higgsBoson.download(HIGGS_SOURCE_CACHE_DIR, downloadOffline);
         }
 
         // Return the status of the operation
@@ -590,15 +644,18 @@ int main(int argc, char* argv[])
         // Setup a return flag
         bool retFlag = false;
 
+        // Extract the named options of the build command
+        auto buildProfile = Utils::extractCommandLineOption(argc, argv, "--profile");
+
         // Handle the default build operation (if applicable)
         if ((argc <= 2) || ((argc > 2) && (std::string(argv[2]) == "default")))
-            retFlag = higgsBoson.buildProject("default");
+            retFlag = higgsBoson.buildProject("default", buildProfile);
 
         // Handle the local build operation (if applicable)
         if ((argc > 2) && (std::string(argv[2]) == "local"))
         {
             HiggsBoson::RunTypeSingleton::setDockerRunCommand("sh");
-            retFlag = higgsBoson.buildProject("local");
+            retFlag = higgsBoson.buildProject("local", buildProfile);
         }
 
         // Handle the internal build operation (if applicable)
@@ -606,7 +663,44 @@ int main(int argc, char* argv[])
                 && ((argc > 3) && (!std::string(argv[3]).empty())))
         {
             HiggsBoson::RunTypeSingleton::setDockerRunCommand("sh");
-            retFlag = higgsBoson.buildProject(std::string(argv[3]));
+            retFlag = higgsBoson.buildProject(std::string(argv[3]), buildProfile);
+        }
+
+        // If the target was anything else, attempt to use
+        // it as a dockcross target instead
+        if ((argc > 2) && isValidDockcrossImage(std::string(argv[2])))
+        {
+            HiggsBoson::RunTypeSingleton::setDockerRunCommand(
+                    getRunTypeCommand(std::string(argv[2]),
+                            currentPath, globalCacheDir, appCacheDir,
+                            projectDirHash), HIGGS_BUILDER_NAME);
+            retFlag = higgsBoson.buildProject(std::string(argv[2]), buildProfile);
+        }
+
+        // Return the status of the operation
+        return (retFlag ? 0 : 1);
+    }
+
+    // Handle build-profile command (if applicable)
+    if ((argc > 1) && (std::string(argv[1]) == "build-profile"))
+    {
+
+        // Setup a return flag
+        bool retFlag = false;
+
+        // Extract the named options of the build-profile command
+        auto buildBudget = Utils::extractCommandLineOption(argc, argv, "--budget");
+
+        // Handle the default build-profile operation (if applicable)
+        if ((argc <= 2) || ((argc > 2) && (std::string(argv[2]) == "default")))
+            retFlag = higgsBoson.profileBuildProject("default", buildBudget);
+
+        // Handle the internal build-profile operation (if applicable)
+        if (((argc > 2) && (std::string(argv[2]) == "internal"))
+                && ((argc > 3) && (!std::string(argv[3]).empty())))
+        {
+            HiggsBoson::RunTypeSingleton::setDockerRunCommand("sh");
+            retFlag = higgsBoson.profileBuildProject(std::string(argv[3]), buildBudget);
         }
 
         // If the target was anything else, attempt to use
@@ -617,21 +711,87 @@ int main(int argc, char* argv[])
                     getRunTypeCommand(std::string(argv[2]),
                             currentPath, globalCacheDir, appCacheDir,
                             projectDirHash), HIGGS_BUILDER_NAME);
-            retFlag = higgsBoson.buildProject(std::string(argv[2]));
+            retFlag = higgsBoson.profileBuildProject(std::string(argv[2]), buildBudget);
         }
 
         // Return the status of the operation
         return (retFlag ? 0 : 1);
     }
 
+    // Handle profile-guided optimization command (if applicable)
+    if ((argc > 1) && (std::string(argv[1]) == "pgo"))
+    {
+
+        // Setup a return flag
+        bool retFlag = false;
+
+        // Handle the default optimization operation (if applicable)
+        // NOTE: The training workload must run natively, so only the default target is supported
+        if ((argc <= 2) || ((argc > 2) && (std::string(argv[2]) == "default")))
+            retFlag = higgsBoson.optimizeProject();
+
+        // Handle the internal optimization operation (if applicable)
+        else if ((argc > 2) && (std::string(argv[2]) == "internal"))
+        {
+            HiggsBoson::RunTypeSingleton::setDockerRunCommand("sh");
+            retFlag = higgsBoson.optimizeProject();
+        }
+
+        // Handle the case where an unsupported target was selected
+        else
+            std::cout << "Profile-guided optimization is only supported for the default target" << std::endl;
+
+        // Return the status of the operation
+        return (retFlag ? 0 : 1);
+    }
+
     // Setup a return flag to handle all remaining (test) cases
     bool retFlag = false;
 
+    // Determine the (test) command being run
+    bool isInternal = (((argc > 2) && (std::string(argv[1]) == "internal"))
+            || ((argc > 3) && (std::string(argv[1]) == "internal")));
+    std::string testCommand = (isInternal ? std::string(argv[2])
+            : ((argc > 1) ? std::string(argv[1]) : ""));
+
+    // Extract the named options of the (test) command being run
+    // NOTE: This must happen before the positional filter is read-in below
+    unsigned int parallelJobs = 1;
+    if ((testCommand == "test") || (testCommand == "coverage") || (testCommand == "sanitize"))
+    {
+        auto parallelOption = Utils::extractCommandLineOption(argc, argv, "--parallel");
+        if (!parallelOption.empty())
+            parallelJobs = static_cast<unsigned int>(std::strtoul(parallelOption.c_str(), nullptr, 10));
+    }
+    bool testAffected = ((testCommand == "test") && Utils::extractCommandLineFlag(argc, argv, "--affected"));
+    std::string coverageBaseRef = ((testCommand == "coverage")
+            ? Utils::extractCommandLineOption(argc, argv, "--base") : "");
+    std::string benchSaveBaseline;
+    std::string benchCompareBaseline;
+    bool recordCounters = false;
+    if (testCommand == "bench")
+    {
+        benchSaveBaseline = Utils::extractCommandLineOption(argc, argv, "--save");
+        benchCompareBaseline = Utils::extractCommandLineOption(argc, argv, "--compare");
+        recordCounters = Utils::extractCommandLineFlag(argc, argv, "--counters");
+    }
+    std::string profileSampler;
+    std::string profileWorkload;
+    bool profileOffCpu = false;
+    bool profileHeap = false;
+    bool profileCache = false;
+    if (testCommand == "profile")
+    {
+        profileSampler = Utils::extractCommandLineOption(argc, argv, "--sampler");
+        profileWorkload = Utils::extractCommandLineOption(argc, argv, "--workload");
+        profileOffCpu = Utils::extractCommandLineFlag(argc, argv, "--offcpu");
+        profileHeap = Utils::extractCommandLineFlag(argc, argv, "--heap");
+        profileCache = Utils::extractCommandLineFlag(argc, argv, "--cache");
+    }
+
     // If there is a filter criteria, read it in as well
     // to apply to tests when they are run
     std::string testFilter = "";
-    bool isInternal = (((argc > 2) && (std::string(argv[1]) == "internal"))
-            || ((argc > 3) && (std::string(argv[1]) == "internal")));
     if (!isInternal && ((((argc > 1) && (std::string(argv[1]) == "sanitize"))
             && (argc > 3) && (!std::string(argv[3]).empty()))
             || ((argc > 1) && (std::string(argv[1]) != "sanitize")
@@ -643,15 +803,59 @@ int main(int argc, char* argv[])
                 && (argc > 3) && (!std::string(argv[3]).empty()))))
         testFilter = std::string(argv[3]);
 
-    // Handle test command (if applicable)
+    // Handle profile command (if applicable)
     if (((argc > 1) && (std::string(argv[1]) == "profile"))
             || (isInternal && (std::string(argv[2]) == "profile")))
-        retFlag = higgsBoson.testProject(CMakeSettings::TestType::PROFILE, testFilter);
+    {
+
+        // Handle the off-CPU (blocked time) profiler operation (if applicable)
+        // NOTE: The filter is the command to run for "run" workloads
+        if (profileOffCpu)
+            retFlag = higgsBoson.profileProject(CMakeSettings::ProfileType::OFF_CPU,
+                    (profileWorkload.empty() ? "test" : profileWorkload), testFilter);
+
+        // Handle the heap (allocation) profiler operation (if applicable)
+        else if (profileHeap)
+            retFlag = higgsBoson.profileProject(CMakeSettings::ProfileType::HEAP,
+                    (profileWorkload.empty() ? "test" : profileWorkload), testFilter);
+
+        // Handle the cache (data cache miss) profiler operation (if applicable)
+        else if (profileCache)
+            retFlag = higgsBoson.profileProject(CMakeSettings::ProfileType::CACHE,
+                    (profileWorkload.empty() ? "test" : profileWorkload), testFilter);
+
+        // Handle the sampling profiler operation (if applicable)
+        else if (profileSampler == "perf")
+            retFlag = higgsBoson.profileProject(CMakeSettings::ProfileType::SAMPLER,
+                    (profileWorkload.empty() ? "test" : profileWorkload), testFilter);
+
+        // Handle the case where an unsupported sampler was selected
+        else if (!profileSampler.empty())
+            std::cout << "Unknown sampler: " << profileSampler << " (supported: perf)" << std::endl;
+
+        // Handle the (default) callgrind profile operation
+        else
+            retFlag = higgsBoson.testProject(CMakeSettings::TestType::PROFILE, testFilter);
+    }
 
     // Handle test command (if applicable)
     if (((argc > 1) && (std::string(argv[1]) == "test"))
             || (isInternal && (std::string(argv[2]) == "test")))
-        retFlag = higgsBoson.testProject(CMakeSettings::TestType::TEST, testFilter);
+    {
+
+        // Handle the affected tests operation, the filter being the base reference (if applicable)
+        if (testAffected)
+            retFlag = higgsBoson.testProjectAffected((testFilter.empty() ? "HEAD" : testFilter), parallelJobs);
+
+        // Handle the (default) test operation
+        else
+            retFlag = higgsBoson.testProject(CMakeSettings::TestType::TEST, testFilter, parallelJobs);
+    }
+
+    // Handle bench command (if applicable)
+    if (((argc > 1) && (std::string(argv[1]) == "bench"))
+            || (isInternal && (std::string(argv[2]) == "bench")))
+        retFlag = higgsBoson.benchProject(testFilter, benchSaveBaseline, benchCompareBaseline, recordCounters);
 
     // Handle debug command (if applicable)
     if (((argc > 1) && (std::string(argv[1]) == "debug"))
@@ -661,36 +865,43 @@ int main(int argc, char* argv[])
     // Handle coverage command (if applicable)
     if (((argc > 1) && (std::string(argv[1]) == "coverage"))
             || (isInternal && (std::string(argv[2]) == "coverage")))
-        retFlag = higgsBoson.testProject(CMakeSettings::TestType::COVERAGE, testFilter);
+        retFlag = higgsBoson.testProject(CMakeSettings::TestType::COVERAGE, testFilter, parallelJobs, coverageBaseRef);
 
     // Handle sanitize command (if applicable)
     if (((argc > 1) && (std::string(argv[1]) == "sanitize"))
             || (isInternal && (std::string(argv[2]) == "sanitize")))
     {
 
+        // Handle the sanitize all operation, building and running the sanitizers concurrently (if applicable)
+        if (((argc > 2) && (std::string(argv[2]) == "all"))
+                || (isInternal && (std::string(argv[3]) == "all")))
+            retFlag = higgsBoson.testProjectMatrix({CMakeSettings::TestType::SANITIZE_ADDRESS,
+                    CMakeSettings::TestType::SANITIZE_BEHAVIOR, CMakeSettings::TestType::SANITIZE_THREAD,
+                    CMakeSettings::TestType::SANITIZE_LEAK});
+
         // Handle the sanitize address operation (if applicable)
-        if (((argc > 2) && (std::string(argv[2]) == "address"))
+        else if (((argc > 2) && (std::string(argv[2]) == "address"))
                 || (isInternal && (std::string(argv[3]) == "address")))
-            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_ADDRESS);
+            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_ADDRESS, "", parallelJobs);
 
         // Handle the sanitize address operation (if applicable)
         else if (((argc > 2) && (std::string(argv[2]) == "behavior"))
                 || (isInternal && (std::string(argv[3]) == "behavior")))
-            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_BEHAVIOR);
+            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_BEHAVIOR, "", parallelJobs);
 
         // Handle the sanitize address operation (if applicable)
         else if (((argc > 2) && (std::string(argv[2]) == "thread"))
                 || (isInternal && (std::string(argv[3]) == "thread")))
-            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_THREAD);
+            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_THREAD, "", parallelJobs);
 
         // Handle the sanitize address operation (if applicable)
         else if (((argc > 2) && (std::string(argv[2]) == "leak"))
                 || (isInternal && (std::string(argv[3]) == "leak")))
-            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_LEAK);
+            retFlag = higgsBoson.testProject(CMakeSettings::TestType::SANITIZE_LEAK, "", parallelJobs);
 
         // Handle the case where no desired sanitizer was selected
         else
-            std::cout << "A valid sanitizer must be chosen: address, behavior, thread, or leak" << std::endl;
+            std::cout << "A valid sanitizer must be chosen: address, behavior, thread, leak, or all" << std::endl;
     }
 
     // Return the result of the return-flag
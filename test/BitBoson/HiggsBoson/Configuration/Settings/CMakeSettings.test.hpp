@@ -162,7 +162,7 @@ TEST_CASE ("External Libraries and Includes CMake Settings Test", "[CMakeSetting
     REQUIRE (!cMakeSettings.buildCMakeProject("default"));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "07f35d601aecffbc18bd3b8ec751df3e28be2c97b4523ee171a30c980e2ad7fd";
+    std::string cMakeHash = "3ee0719dec4fc9df05672e47005803946d6112ffd99b721fb11726cb46cd8c37";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -193,7 +193,7 @@ TEST_CASE ("Generic Executable CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.buildCMakeProject("default"));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "91e42b56cd068e1d703d6965c1b9673e25421635ff45fb0254aec4bcfa7e9fb0";
+    std::string cMakeHash = "c7b24f29352a0f7e31318ea07ccc86478de8c380fb04ea7c2be273d9189c4e00";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -201,6 +201,34 @@ TEST_CASE ("Generic Executable CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
 }
 
+TEST_CASE ("Main-Only Executable CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files (with a self-contained main file)
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+    auto mainFile = FileWriter("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (mainFile.isOpen());
+    mainFile.writeLine("int main() { return 0; };");
+    mainFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (only the main source)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+
+    // Build the C++ project (without any other sources) and validate its outputs
+    REQUIRE (cMakeSettings.buildCMakeProject("default"));
+    REQUIRE (ExecShell::exec("ls /tmp/higgs-boson/test-proj/.higgs-boson/builds/compile/default/bin") == "test-proj\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
 TEST_CASE ("Generic Library CMake Settings Test", "[CMakeSettingsTest]")
 {
 
@@ -219,13 +247,424 @@ TEST_CASE ("Generic Library CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
     REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
 
-    // Build the C++ project and validate its outputs
+    // Build the C++ project and validate its outputs
+    REQUIRE (cMakeSettings.buildCMakeProject("default"));
+
+    // Verify the contents of the CMakeLists.txt file
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
+    std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
+    REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Precompiled Headers CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Setup explicit precompiled headers and disable the auto-detection
+    cMakeSettings.addPrecompiledHeader("<vector>");
+    cMakeSettings.addPrecompiledHeader("map");
+    cMakeSettings.setPrecompiledHeadersLimit(0);
+
+    // Build the C++ project and validate its outputs
+    REQUIRE (cMakeSettings.buildCMakeProject("default"));
+
+    // Verify only the explicit headers were setup for pre-compilation
+    std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
+    REQUIRE (ExecShell::exec("grep -c '\"<vector>\"' " + cMakeFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '\"<map>\"' " + cMakeFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '\"<string>\"' " + cMakeFile) == "0\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Link-Time Optimization CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Setup thin link-time optimization for the default target
+    cMakeSettings.setLinkTimeOptimization("default", "thin");
+
+    // Build the C++ project and validate its outputs
+    REQUIRE (cMakeSettings.buildCMakeProject("default"));
+
+    // Verify the link-time optimization mode was passed to CMake
+    std::string buildFile = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/compile-default.sh";
+    REQUIRE (ExecShell::exec("grep -c -- '-DHIGGS_LTO=thin' " + buildFile) == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Linker and Debug Information CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Setup the gold linker with split debug information
+    cMakeSettings.setLinker("gold");
+    cMakeSettings.setDebugInfo("split");
+
+    // Build the C++ project and validate its outputs
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+
+    // Verify the linker and debug information settings were used
+    std::string buildDir = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/test";
+    REQUIRE (ExecShell::exec("grep -c 'fuse-ld=gold.*--gdb-index' " + buildDir
+            + "/CMakeFiles/test-proj_test.dir/link.txt") == "1\n");
+    REQUIRE (!ExecShell::exec("find " + buildDir + " -name 'helper.cpp.dwo'").empty());
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Build Profile CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Setup a custom build profile for the default target
+    cMakeSettings.addBuildProfile("fast", "default", "RelWithDebInfo", {"-O3", "-fno-plt"}, {"-Wl,-O1"});
+
+    // Build the C++ project using the profile and validate its outputs
+    REQUIRE (cMakeSettings.buildCMakeProject("default", "fast"));
+    std::string buildFile = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/compile-default-fast.sh";
+    REQUIRE (ExecShell::exec("grep -c -- '-DHIGGS_COMPILE_FLAGS=-O3;-fno-plt' " + buildFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c -- '-DHIGGS_LINK_FLAGS=-Wl,-O1' " + buildFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c -- '-DCMAKE_BUILD_TYPE=RelWithDebInfo' " + buildFile) == "1\n");
+    REQUIRE (ExecShell::exec("ls /tmp/higgs-boson/test-proj/.higgs-boson/builds/compile/default-fast/bin")
+            == "test-proj\n");
+
+    // Verify unknown build profiles are rejected
+    REQUIRE (!cMakeSettings.buildCMakeProject("default", "unknown"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Compile-Time Profile CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Verify unknown time budgets are rejected
+    REQUIRE (!cMakeSettings.profileBuildCMakeProject("default", "/tmp/higgs-boson/test-proj/missing-budget.txt"));
+
+    // Profile the compile-time of the project and validate the report
+    REQUIRE (cMakeSettings.profileBuildCMakeProject("default"));
+    std::string reportFile = "/tmp/higgs-boson/test-proj/output/build-profile/default.txt";
+    REQUIRE (ExecShell::exec("grep -c 'Slowest translation units:' " + reportFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c 'src/TestProj/helper.cpp$' " + reportFile) == "1\n");
+
+    // Verify a translation unit exceeding the time budget fails the build
+    REQUIRE (system(std::string("echo '* 0.001' > /tmp/higgs-boson/test-proj/budget.txt").c_str()) == 0);
+    REQUIRE (!cMakeSettings.profileBuildCMakeProject("default", "/tmp/higgs-boson/test-proj/budget.txt"));
+    REQUIRE (ExecShell::exec("grep -c 'Budget violations' " + reportFile) == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Profile-Guided Optimization CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Generate the optimization profile using the test-suite as the workload
+    cMakeSettings.setOptimizationWorkload("test", "");
+    REQUIRE (cMakeSettings.generateOptimizationProfile());
+
+    // Verify a single (source-hash keyed) profile was cached
+    std::string profileDir = "/tmp/higgs-boson/test-proj/.higgs-boson/pgo";
+    REQUIRE (ExecShell::exec("ls " + profileDir + " | grep -c '\\.profdata$'") == "1\n");
+
+    // Build the C++ project and verify the cached profile was used
+    REQUIRE (cMakeSettings.buildCMakeProject("default"));
+    std::string buildFile = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/compile-default.sh";
+    REQUIRE (ExecShell::exec("grep -c -- '-DHIGGS_PGO_PROFILE=' " + buildFile) == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Sampling Profiler CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Verify an unknown workload is reported as a failure
+    REQUIRE (!cMakeSettings.profileCMakeProject(CMakeSettings::ProfileType::SAMPLER, "unknown"));
+
+    // Profile the test-suite with the sampling profiler
+    REQUIRE (cMakeSettings.profileCMakeProject(CMakeSettings::ProfileType::SAMPLER, "test"));
+
+    // Verify the frame-pointer build and the folded stacks and flame graph were written
+    std::string buildFile = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/profile-perf.sh";
+    REQUIRE (ExecShell::exec("grep -c -- '-fno-omit-frame-pointer' " + buildFile) == "1\n");
+    std::string outputDir = "/tmp/higgs-boson/test-proj/output/profile";
+    REQUIRE (system(std::string("test -s " + outputDir + "/perf.folded").c_str()) == 0);
+    REQUIRE (ExecShell::exec("grep -c '<svg' " + outputDir + "/perf.svg") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Off-CPU Profiler CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Profile a (sleeping) run command with the off-CPU profiler
+    REQUIRE (cMakeSettings.profileCMakeProject(CMakeSettings::ProfileType::OFF_CPU, "run", "sleep 0.1"));
+
+    // Verify the blocked time report and flame graph were written
+    std::string outputDir = "/tmp/higgs-boson/test-proj/output/profile";
+    REQUIRE (ExecShell::exec("grep -c 'Total blocked time' " + outputDir + "/offcpu.txt") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '<svg' " + outputDir + "/offcpu.svg") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Heap Profiler CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Profile the test-suite with the heap profiler
+    REQUIRE (cMakeSettings.profileCMakeProject(CMakeSettings::ProfileType::HEAP, "test"));
+
+    // Verify the allocation report, timeline, and flame graph were written
+    std::string outputDir = "/tmp/higgs-boson/test-proj/output/profile";
+    REQUIRE (ExecShell::exec("grep -c 'peak heap memory consumption' " + outputDir + "/heap.txt") == "1\n");
+    REQUIRE (system(std::string("test -s " + outputDir + "/heap.massif").c_str()) == 0);
+    REQUIRE (ExecShell::exec("grep -c '<svg' " + outputDir + "/heap.svg") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Cache Profiler CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Profile the test-suite with the cache profiler
+    REQUIRE (cMakeSettings.profileCMakeProject(CMakeSettings::ProfileType::CACHE, "test"));
+
+    // Verify the miss report and the (per-line) annotations were written
+    std::string outputDir = "/tmp/higgs-boson/test-proj/output/profile";
+    REQUIRE (ExecShell::exec("grep -c 'Top functions by D1 misses:' " + outputDir + "/cache.txt") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c 'Top source lines by D1 misses:' " + outputDir + "/cache.txt") == "1\n");
+    REQUIRE (system(std::string("test -s " + outputDir + "/cache.annotate.txt").c_str()) == 0);
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Auto-Detected Precompiled Headers CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup an additional header and source both using (and conditionally using) headers
+    auto otherHeaderFile = FileWriter("/tmp/higgs-boson/test-proj/src/TestProj/other.h");
+    REQUIRE (otherHeaderFile.isOpen());
+    otherHeaderFile.writeLine("#ifndef HIGGS_BOSON_OTHER_H");
+    otherHeaderFile.writeLine("#define HIGGS_BOSON_OTHER_H");
+    otherHeaderFile.writeLine("#include <vector>");
+    otherHeaderFile.writeLine("#ifdef _WIN32");
+    otherHeaderFile.writeLine("#include <windows.h>");
+    otherHeaderFile.writeLine("#endif");
+    otherHeaderFile.writeLine("std::vector<int> getValues();");
+    otherHeaderFile.writeLine("#endif // HIGGS_BOSON_OTHER_H");
+    otherHeaderFile.close();
+    auto otherSourceFile = FileWriter("/tmp/higgs-boson/test-proj/src/TestProj/other.cpp");
+    REQUIRE (otherSourceFile.isOpen());
+    otherSourceFile.writeLine("#include <vector>");
+    otherSourceFile.writeLine("#ifdef _WIN32");
+    otherSourceFile.writeLine("#include <windows.h>");
+    otherSourceFile.writeLine("#endif");
+    otherSourceFile.writeLine("#include <TestProj/other.h>");
+    otherSourceFile.writeLine("std::vector<int> getValues() { return {1}; }");
+    otherSourceFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/other.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/other.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Verify no headers are auto-detected by default
+    std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (cMakeSettings.buildCMakeProject("default"));
+    REQUIRE (ExecShell::exec("grep -c '\"<vector>\"' " + cMakeFile) == "0\n");
 
-    // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
-    std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
-    REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
+    // Verify only the unconditional (non-test) includes are auto-detected once enabled
+    cMakeSettings.setPrecompiledHeadersLimit(10);
+    REQUIRE (cMakeSettings.buildCMakeProject("default"));
+    REQUIRE (ExecShell::exec("grep -c '\"<vector>\"' " + cMakeFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '\"<windows.h>\"' " + cMakeFile) == "0\n");
+    REQUIRE (ExecShell::exec("grep -c '\"<string>\"' " + cMakeFile) == "0\n");
+
+    // Verify Catch2 is only precompiled for the test target
+    REQUIRE (ExecShell::exec("grep -c 'catch.hpp' " + cMakeFile) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c 'list(APPEND HIGGS_TEST_PRECOMPILED_HEADERS' " + cMakeFile) == "1\n");
 
     // Cleanup the temporary files
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
@@ -290,7 +729,7 @@ TEST_CASE ("Run Test CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -298,6 +737,330 @@ TEST_CASE ("Run Test CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
 }
 
+TEST_CASE ("Run Sharded Test CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Write-in a second testing file for the second shard
+    auto testFile = FileWriter("/tmp/higgs-boson/test-proj/test/TestProj/helper2.test.hpp");
+    REQUIRE (testFile.isOpen());
+    testFile.writeLine("#ifndef HIGGS_BOSON_HELPER2_TEST_HPP");
+    testFile.writeLine("#define HIGGS_BOSON_HELPER2_TEST_HPP");
+    testFile.writeLine("#include <TestProj/helper.h>");
+    testFile.writeLine("TEST_CASE (\"Test2\", \"[TestSect2]\") { REQUIRE (!getMessage().empty()); }");
+    testFile.writeLine("#endif // HIGGS_BOSON_HELPER2_TEST_HPP");
+    testFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper2.test.hpp"));
+
+    // Split the tests across two shards
+    cMakeSettings.setTestShards(2);
+
+    // Build the C++ project and validate its outputs
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+
+    // Verify each testing file was placed in its own shard
+    std::string shardPrefix = "/tmp/higgs-boson/test-proj/.higgs-boson/tests-";
+    REQUIRE (ExecShell::exec("grep -c 'helper.test.hpp' " + shardPrefix + "0.test.cpp") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c 'helper2.test.hpp' " + shardPrefix + "1.test.cpp") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Run Parallel Test CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Write-in a second testing file with an additional test-case
+    auto testFile = FileWriter("/tmp/higgs-boson/test-proj/test/TestProj/helper2.test.hpp");
+    REQUIRE (testFile.isOpen());
+    testFile.writeLine("#ifndef HIGGS_BOSON_HELPER2_TEST_HPP");
+    testFile.writeLine("#define HIGGS_BOSON_HELPER2_TEST_HPP");
+    testFile.writeLine("#include <TestProj/helper.h>");
+    testFile.writeLine("TEST_CASE (\"Test2\", \"[TestSect2]\") { REQUIRE (!getMessage().empty()); }");
+    testFile.writeLine("#endif // HIGGS_BOSON_HELPER2_TEST_HPP");
+    testFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper2.test.hpp"));
+
+    // Build the C++ project and run the tests across two processes
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST, "", 2));
+
+    // Verify the merged results and the recorded durations
+    std::string buildsDir = "/tmp/higgs-boson/test-proj/.higgs-boson/builds";
+    REQUIRE (ExecShell::exec("grep -c '<testcase ' " + buildsDir + "/test-parallel/results.xml") == "2\n");
+    REQUIRE (ExecShell::exec("wc -l < " + buildsDir + "/test.durations.tsv") == "2\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Incremental Test Build CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Build and run the tests, marking the time after the initial build
+    std::string buildDir = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/test";
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+    REQUIRE (system(std::string("sleep 1 && touch /tmp/higgs-boson/test-proj/built.marker").c_str()) == 0);
+
+    // Verify an unchanged project is neither re-configured nor re-compiled
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+    REQUIRE (ExecShell::exec("find " + buildDir + " -name 'helper.cpp.o' -newer /tmp/higgs-boson/test-proj/built.marker").empty());
+    REQUIRE (ExecShell::exec("find " + buildDir + " -name 'CMakeCache.txt' -newer /tmp/higgs-boson/test-proj/built.marker").empty());
+
+    // Verify only the changed source file is re-compiled
+    REQUIRE (system(std::string("echo '// Changed' >> /tmp/higgs-boson/test-proj/src/TestProj/helper.cpp").c_str()) == 0);
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+    REQUIRE (!ExecShell::exec("find " + buildDir + " -name 'helper.cpp.o' -newer /tmp/higgs-boson/test-proj/built.marker").empty());
+    REQUIRE (ExecShell::exec("find " + buildDir + " -name 'main.test.cpp.o' -newer /tmp/higgs-boson/test-proj/built.marker").empty());
+
+    // Verify a failed re-compile fails the tests rather than running the stale tests
+    REQUIRE (system(std::string("echo '#error Broken' >> /tmp/higgs-boson/test-proj/src/TestProj/helper.cpp").c_str()) == 0);
+    REQUIRE (!cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Run Sanitizer Matrix CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Only unattended test-types can be run as a matrix
+    REQUIRE (!cMakeSettings.testCMakeProjectMatrix({CMakeSettings::TestType::COVERAGE}));
+
+    // Build and run all of the sanitizers concurrently
+    REQUIRE (cMakeSettings.testCMakeProjectMatrix({CMakeSettings::TestType::SANITIZE_ADDRESS,
+            CMakeSettings::TestType::SANITIZE_BEHAVIOR, CMakeSettings::TestType::SANITIZE_THREAD,
+            CMakeSettings::TestType::SANITIZE_LEAK}));
+
+    // Verify each sanitizer was built and run in its own build tree
+    std::string buildsDir = "/tmp/higgs-boson/test-proj/.higgs-boson/builds";
+    for (const auto& sanitizer : {"address", "behavior", "thread", "leak"})
+    {
+        REQUIRE (ExecShell::exec("cat " + buildsDir + "/" + sanitizer + ".run.status") == "PASS\n");
+        REQUIRE (ExecShell::exec("ls " + buildsDir + "/" + sanitizer + "/bin") == "test-proj_test\n");
+    }
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Run Benchmark CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj/bench/TestProj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Write-in a benchmark file with two benchmarks
+    auto benchFile = FileWriter("/tmp/higgs-boson/test-proj/bench/TestProj/helper.bench.hpp");
+    REQUIRE (benchFile.isOpen());
+    benchFile.writeLine("#include <higgs-bench.hpp>");
+    benchFile.writeLine("#include <TestProj/helper.h>");
+    benchFile.writeLine("HIGGS_BENCHMARK (\"Get Message\") { while (state.keepRunning()) HiggsBench::doNotOptimize(getMessage()); }");
+    benchFile.writeLine("HIGGS_BENCHMARK (\"Empty Loop\") { while (state.keepRunning()) {} }");
+    benchFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, testing, and benchmark)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+    REQUIRE (cMakeSettings.addBenchmarkFile("/tmp/higgs-boson/test-proj/bench/TestProj/helper.bench.hpp"));
+
+    // Build and run the filtered benchmarks
+    REQUIRE (cMakeSettings.benchCMakeProject("Message"));
+
+    // Verify only the filtered benchmark was written to the results
+    std::string outputDir = "/tmp/higgs-boson/test-proj/output/bench";
+    REQUIRE (ExecShell::exec("grep -c '\"name\": \"Get Message\"' " + outputDir + "/results.json") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c 'Empty Loop' " + outputDir + "/results.json") == "0\n");
+    REQUIRE (ExecShell::exec("wc -l < " + outputDir + "/results.tsv") == "2\n");
+
+    // Verify a filter without any matching benchmarks is reported as a failure
+    REQUIRE (!cMakeSettings.benchCMakeProject("Unknown"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Benchmark Baseline CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj/bench/TestProj").c_str()) == 0);
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj/.higgs-boson/bench").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Write-in a benchmark file with a single benchmark
+    auto benchFile = FileWriter("/tmp/higgs-boson/test-proj/bench/TestProj/helper.bench.hpp");
+    REQUIRE (benchFile.isOpen());
+    benchFile.writeLine("#include <higgs-bench.hpp>");
+    benchFile.writeLine("#include <TestProj/helper.h>");
+    benchFile.writeLine("HIGGS_BENCHMARK (\"Get Message\") { while (state.keepRunning()) HiggsBench::doNotOptimize(getMessage()); }");
+    benchFile.close();
+
+    // Write-in an impossibly fast and an impossibly slow baseline to compare against
+    std::string baselineDir = "/tmp/higgs-boson/test-proj/.higgs-boson/bench";
+    auto fastFile = FileWriter(baselineDir + "/fast.json");
+    REQUIRE (fastFile.isOpen());
+    fastFile.writeLine("{");
+    fastFile.writeLine("  \"benchmarks\": [");
+    fastFile.writeLine("    {\"name\": \"Get Message\", \"ns_per_op\": 0.001, \"samples_ns_per_op\": "
+            "[0.001, 0.001, 0.001, 0.001, 0.001, 0.001, 0.001, 0.001, 0.001, 0.001]}");
+    fastFile.writeLine("  ]");
+    fastFile.writeLine("}");
+    fastFile.close();
+    auto slowFile = FileWriter(baselineDir + "/slow.json");
+    REQUIRE (slowFile.isOpen());
+    slowFile.writeLine("{");
+    slowFile.writeLine("  \"benchmarks\": [");
+    slowFile.writeLine("    {\"name\": \"Get Message\", \"ns_per_op\": 1e9, \"samples_ns_per_op\": "
+            "[1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 1e9, 1e9]}");
+    slowFile.writeLine("  ]");
+    slowFile.writeLine("}");
+    slowFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+    cMakeSettings.setBenchmarkRegressionGate(10.0, 0.01);
+
+    // Setup the CMake project files (source, header, testing, and benchmark)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addBenchmarkFile("/tmp/higgs-boson/test-proj/bench/TestProj/helper.bench.hpp"));
+
+    // Run the benchmarks saving the results as a baseline
+    REQUIRE (cMakeSettings.benchCMakeProject("", "main"));
+    REQUIRE (ExecShell::exec("grep -c '\"name\": \"Get Message\"' " + baselineDir + "/main.json") == "1\n");
+
+    // Verify comparisons gate on significant regressions only
+    REQUIRE (cMakeSettings.benchCMakeProject("", "", "slow"));
+    REQUIRE (!cMakeSettings.benchCMakeProject("", "", "fast"));
+
+    // Verify regressed results are not saved over the baseline
+    REQUIRE (!cMakeSettings.benchCMakeProject("", "fast", "fast"));
+    REQUIRE (ExecShell::exec("grep -c '0.001' " + baselineDir + "/fast.json") == "1\n");
+
+    // Verify comparing against an unknown baseline is reported as a failure
+    REQUIRE (!cMakeSettings.benchCMakeProject("", "", "unknown"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Benchmark Hardware Counters CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj/bench/TestProj").c_str()) == 0);
+
+    // Setup the project testing files
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+
+    // Write-in a benchmark file with a single benchmark
+    auto benchFile = FileWriter("/tmp/higgs-boson/test-proj/bench/TestProj/helper.bench.hpp");
+    REQUIRE (benchFile.isOpen());
+    benchFile.writeLine("#include <higgs-bench.hpp>");
+    benchFile.writeLine("#include <TestProj/helper.h>");
+    benchFile.writeLine("HIGGS_BENCHMARK (\"Get Message\") { while (state.keepRunning()) HiggsBench::doNotOptimize(getMessage()); }");
+    benchFile.close();
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, testing, and benchmark)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+    REQUIRE (cMakeSettings.addBenchmarkFile("/tmp/higgs-boson/test-proj/bench/TestProj/helper.bench.hpp"));
+
+    // Run the benchmarks twice while recording the hardware counters
+    REQUIRE (cMakeSettings.benchCMakeProject("", "", "", true));
+    REQUIRE (cMakeSettings.benchCMakeProject("", "", "", true));
+
+    // Verify the counters were appended to the metrics history
+    std::string metricsPath = "/tmp/higgs-boson/test-proj/.higgs-boson/metrics/bench.tsv";
+    REQUIRE (ExecShell::exec("wc -l < " + metricsPath) == "3\n");
+    REQUIRE (ExecShell::exec("tail -n 1 " + metricsPath + " | cut -f 2") == "unknown\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
 TEST_CASE ("Run Test with Commands CMake Settings Test", "[CMakeSettingsTest]")
 {
 
@@ -330,6 +1093,15 @@ TEST_CASE ("Run Test with Commands CMake Settings Test", "[CMakeSettingsTest]")
     // Verify the CMakeList.txt file was removed by the post-build commands
     REQUIRE (system(std::string("ls -ltr /tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt").c_str()) != 0);
 
+    // Verify a failing test still fails once the post-test commands have run
+    auto failingTestFile = FileWriter("/tmp/higgs-boson/test-proj/test/TestProj/failing.test.hpp");
+    REQUIRE (failingTestFile.isOpen());
+    failingTestFile.writeLine("TEST_CASE (\"Failing\", \"[FailingSect]\") { REQUIRE (false); }");
+    failingTestFile.close();
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/failing.test.hpp"));
+    REQUIRE (!cMakeSettings.testCMakeProject(CMakeSettings::TestType::TEST));
+    REQUIRE (system(std::string("ls -ltr /tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt").c_str()) != 0);
+
     // Cleanup the temporary files
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
 }
@@ -357,7 +1129,7 @@ TEST_CASE ("Run Coverage CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::COVERAGE));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -365,6 +1137,116 @@ TEST_CASE ("Run Coverage CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
 }
 
+TEST_CASE ("Run Parallel Changed-Files Coverage CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files (committing them as the base reference)
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+    REQUIRE (system(std::string("cd /tmp/higgs-boson/test-proj && git init -q && git add src test"
+            " && git -c user.name=test -c user.email=test@test.com commit -q -m base").c_str()) == 0);
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+
+    // Change a source file against the base reference
+    REQUIRE (system(std::string("echo '// Changed' >> /tmp/higgs-boson/test-proj/src/TestProj/helper.cpp").c_str()) == 0);
+
+    // Verify unknown (or unfetched) base references fail before anything is built
+    std::string buildsDir = "/tmp/higgs-boson/test-proj/.higgs-boson/builds";
+    REQUIRE (!cMakeSettings.testCMakeProject(CMakeSettings::TestType::COVERAGE, "", 2, "unknown-ref"));
+    REQUIRE (ExecShell::exec("ls " + buildsDir + "/coverage 2> /dev/null || true").empty());
+
+    // Verify failed builds fail without reporting any coverage (then fix the build)
+    REQUIRE (system(std::string("echo '#error Broken' >> /tmp/higgs-boson/test-proj/src/TestProj/helper.cpp").c_str()) == 0);
+    REQUIRE (!cMakeSettings.testCMakeProject(CMakeSettings::TestType::COVERAGE, "", 2, "HEAD"));
+    REQUIRE (ExecShell::exec("ls " + buildsDir + "/coverage.report.sh 2> /dev/null || true").empty());
+    REQUIRE (system(std::string("sed -i '/#error Broken/d' /tmp/higgs-boson/test-proj/src/TestProj/helper.cpp").c_str()) == 0);
+
+    // Build the C++ project and run the coverage across two processes
+    REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::COVERAGE, "", 2, "HEAD"));
+
+    // Verify the per-process profiles were merged and only the changed file was reported
+    REQUIRE (ExecShell::exec("ls " + buildsDir + "/coverage/profraw | wc -l") == "2\n");
+    REQUIRE (ExecShell::exec("ls " + buildsDir + "/coverage/test-proj_test.profdata") == (buildsDir + "/coverage/test-proj_test.profdata\n"));
+    REQUIRE (ExecShell::exec("grep -c 'helper.cpp' " + buildsDir + "/coverage.report.sh") == "2\n");
+    REQUIRE (ExecShell::exec("grep -c 'main.cpp' " + buildsDir + "/coverage.report.sh") == "0\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
+TEST_CASE ("Run Affected Tests CMake Settings Test", "[CMakeSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj").c_str()) == 0);
+
+    // Setup the project testing files, alongside an unrelated testing file using an
+    // external include (committing them as the base reference)
+    REQUIRE (writeProjectFiles("/tmp/higgs-boson/test-proj"));
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/test-proj/include/Extra"
+            " && echo '#define EXTRA_VALUE 1' > /tmp/higgs-boson/test-proj/include/Extra/extra.h").c_str()) == 0);
+    REQUIRE (system(std::string("echo '#include <Extra/extra.h>' > /tmp/higgs-boson/test-proj/test/TestProj/other.test.hpp"
+            " && echo 'SCENARIO (\"Other\", \"[TestSect2]\") { REQUIRE (EXTRA_VALUE == 1); }'"
+            " >> /tmp/higgs-boson/test-proj/test/TestProj/other.test.hpp").c_str()) == 0);
+    REQUIRE (system(std::string("cd /tmp/higgs-boson/test-proj && git init -q && git add src test include"
+            " && git -c user.name=test -c user.email=test@test.com commit -q -m base").c_str()) == 0);
+
+    // Setup the CMake Settings object
+    auto cMakeSettings = CMakeSettings("test-proj", "1.0.0",
+            "/tmp/higgs-boson/test-proj", "/tmp/higgs-boson/test-proj/.higgs-boson");
+
+    // Setup the CMake project files (source, header, and testing)
+    cMakeSettings.setMainSource("/tmp/higgs-boson/test-proj/src/TestProj/main.cpp");
+    REQUIRE (cMakeSettings.addHeaderFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.h"));
+    REQUIRE (cMakeSettings.addSourceFile("/tmp/higgs-boson/test-proj/src/TestProj/helper.cpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/helper.test.hpp"));
+    REQUIRE (cMakeSettings.addTestingFile("/tmp/higgs-boson/test-proj/test/TestProj/other.test.hpp"));
+    cMakeSettings.addIncludeDir("/tmp/higgs-boson/test-proj/include");
+
+    // Verify no tests are run without any changes against the base reference
+    std::string specFile = "/tmp/higgs-boson/test-proj/.higgs-boson/builds/affected.txt";
+    REQUIRE (cMakeSettings.testCMakeProjectAffected("HEAD"));
+    REQUIRE (ExecShell::exec("ls " + specFile + " 2> /dev/null || true").empty());
+
+    // Verify unknown (or unfetched) base references fail rather than skipping the tests
+    REQUIRE (!cMakeSettings.testCMakeProjectAffected("unknown-ref"));
+    REQUIRE (!cMakeSettings.testCMakeProjectAffected("HEAD~1"));
+
+    // Verify changing the external header only runs the tests including it
+    REQUIRE (system(std::string("echo '// Changed' >> /tmp/higgs-boson/test-proj/include/Extra/extra.h").c_str()) == 0);
+    REQUIRE (cMakeSettings.testCMakeProjectAffected("HEAD"));
+    REQUIRE (ExecShell::exec("cat " + specFile) == "Scenario: Other\n");
+    REQUIRE (system(std::string("cd /tmp/higgs-boson/test-proj && git checkout -q include").c_str()) == 0);
+
+    // Change a source file against the base reference
+    REQUIRE (system(std::string("echo '// Changed' >> /tmp/higgs-boson/test-proj/src/TestProj/helper.cpp").c_str()) == 0);
+
+    // Build the C++ project and verify only the tests including its header were run
+    REQUIRE (cMakeSettings.testCMakeProjectAffected("HEAD"));
+    REQUIRE (ExecShell::exec("cat " + specFile) == "Test1\n");
+
+    // Change the unrelated testing file as well
+    REQUIRE (system(std::string("echo '// Changed' >> /tmp/higgs-boson/test-proj/test/TestProj/other.test.hpp").c_str()) == 0);
+
+    // Verify both testing files' tests were run
+    REQUIRE (cMakeSettings.testCMakeProjectAffected("HEAD"));
+    REQUIRE (ExecShell::exec("cat " + specFile) == "Test1\nScenario: Other\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/test-proj").c_str()) == 0);
+}
+
 TEST_CASE ("Run Sanitize-Address CMake Settings Test", "[CMakeSettingsTest]")
 {
 
@@ -388,7 +1270,7 @@ TEST_CASE ("Run Sanitize-Address CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::SANITIZE_ADDRESS));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -419,7 +1301,7 @@ TEST_CASE ("Run Sanitize-Behavior CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::SANITIZE_BEHAVIOR));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -450,7 +1332,7 @@ TEST_CASE ("Run Sanitize-Thread CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::SANITIZE_THREAD));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -481,7 +1363,7 @@ TEST_CASE ("Run Sanitize-Leak CMake Settings Test", "[CMakeSettingsTest]")
     REQUIRE (cMakeSettings.testCMakeProject(CMakeSettings::TestType::SANITIZE_LEAK));
 
     // Verify the contents of the CMakeLists.txt file
-    std::string cMakeHash = "bf3e399c351c5836ca9b0a9e2b30ded29600f0a8bc9df5c5df1de5fdc82287d9";
+    std::string cMakeHash = "fbd36357e7c4d4c61017daad8f488cd414197562ff52214b0f5dc879f8ce276b";
     std::string cMakeFile = "/tmp/higgs-boson/test-proj/.higgs-boson/CMakeLists.txt";
     REQUIRE (ExecShell::exec("sha256sum " + cMakeFile) == (cMakeHash + "  " + cMakeFile + "\n"));
 
@@ -0,0 +1,281 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_DOWNLOAD_SETTINGS_TEST_HPP
+#define HIGGS_BOSON_DOWNLOAD_SETTINGS_TEST_HPP
+
+#include <string>
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
+#include <BitBoson/HiggsBoson/Configuration/Settings/DownloadSettings.h>
+
+using namespace BitBoson;
+
+/**
+ * Helper function used to setup a local bare git repository with two tagged
+ * commits (each writing its version to "version.txt")
+ *
+ * @param repoPath String representing the path to the bare repository to create
+ * @return String representing the (full) commit hash of the first commit
+ */
+std::string writeBareRepository(const std::string& repoPath)
+{
+
+    // Create the repository with the two tagged commits and push it to the bare repository
+    std::string workPath = repoPath + ".work";
+    ExecShell::exec("git init -q --bare " + repoPath + " && git init -q " + workPath
+            + " && cd " + workPath + " && echo v1 > version.txt && git add version.txt"
+            + " && git -c user.name=test -c user.email=test@test.com commit -q -m v1 && git tag v1"
+            + " && echo v2 > version.txt && git -c user.name=test -c user.email=test@test.com commit -q -am v2"
+            + " && git tag v2 && git push -q --tags " + repoPath + " HEAD:refs/heads/master");
+
+    // Return the hash of the first commit
+    return ExecShell::exec("git -C " + workPath + " rev-parse v1^{commit} | tr -d '\\n'");
+}
+
+/**
+ * Helper function used to serve a directory over HTTP locally (in the background)
+ * NOTE: The server is stopped by removing the directory's ".pid" file process
+ *
+ * @param servePath String representing the path to the directory to serve
+ * @param port String representing the local port to serve the directory on
+ * @return Boolean indicating whether the server is up and running
+ */
+bool serveDirectory(const std::string& servePath, const std::string& port)
+{
+
+    // Start the server and wait for it to accept connections
+    return (system(std::string("cd " + servePath + " && (python3 -m http.server " + port
+            + " --bind 127.0.0.1 > /dev/null 2>&1 & echo $! > " + servePath + ".pid)"
+            + " && for i in $(seq 1 50); do curl -fs -o /dev/null http://127.0.0.1:" + port
+            + "/ && exit 0; sleep 0.1; done; exit 1").c_str()) == 0);
+}
+
+TEST_CASE ("Native Git Download Settings Test", "[DownloadSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    std::string testDir = "/tmp/higgs-boson/download-test";
+    REQUIRE (system(std::string("mkdir -p " + testDir).c_str()) == 0);
+    auto firstCommit = writeBareRepository(testDir + "/remote.git");
+    REQUIRE (firstCommit.size() == 40);
+
+    // Setup the download settings with modules pinned to a commit, a tag, and the default branch
+    auto downloadSettings = DownloadSettings(testDir + "/download", testDir + "/raw");
+    downloadSettings.setParallelJobs(2);
+    REQUIRE (downloadSettings.addModule("bycommit", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", firstCommit}}));
+    REQUIRE (downloadSettings.addModule("bytag", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", "v2"}}));
+    REQUIRE (downloadSettings.addModule("byhead", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"}}));
+
+    // Verify unsupported and duplicate modules are rejected
+    REQUIRE (!downloadSettings.addModule("bytag", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"}}));
+    REQUIRE (!downloadSettings.addModule("byhg", {{"type", "hg"}, {"url", "file://" + testDir + "/remote.hg"}}));
+    REQUIRE (!downloadSettings.addModule("bycurl", {{"type", "curl"}}));
+    REQUIRE (!downloadSettings.addModule("byempty", {{"type", "git"}}));
+
+    // Download the modules and verify the trees were exported at their revisions
+    REQUIRE (downloadSettings.download());
+    REQUIRE (ExecShell::exec("cat " + testDir + "/raw/bycommit/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/raw/bytag/version.txt") == "v2\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/raw/byhead/version.txt") == "v2\n");
+    REQUIRE (ExecShell::exec("ls -A " + testDir + "/raw/bytag") == "version.txt\n");
+    REQUIRE (ExecShell::exec("ls -A " + testDir + "/raw") == "bycommit\nbyhead\nbytag\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/download.status/*") == "OK\nOK\nOK\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf " + testDir).c_str()) == 0);
+}
+
+TEST_CASE ("Failed Native Git Download Settings Test", "[DownloadSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    std::string testDir = "/tmp/higgs-boson/download-test";
+    REQUIRE (system(std::string("mkdir -p " + testDir).c_str()) == 0);
+    writeBareRepository(testDir + "/remote.git");
+
+    // Setup the download settings with a valid module and one with an unknown revision
+    auto downloadSettings = DownloadSettings(testDir + "/download", testDir + "/raw");
+    downloadSettings.setRetries(2);
+    REQUIRE (downloadSettings.addModule("valid", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", "v1"}}));
+    REQUIRE (downloadSettings.addModule("invalid", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", "unknown-rev"}}));
+
+    // Verify the download fails while still downloading the valid module
+    REQUIRE (!downloadSettings.download());
+    REQUIRE (ExecShell::exec("cat " + testDir + "/raw/valid/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/download.status/invalid") == "FAILED\n");
+    REQUIRE (ExecShell::exec("ls -A " + testDir + "/raw") == "valid\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf " + testDir).c_str()) == 0);
+}
+
+TEST_CASE ("Source Cache Download Settings Test", "[DownloadSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    std::string testDir = "/tmp/higgs-boson/download-test";
+    REQUIRE (system(std::string("mkdir -p " + testDir + "/first " + testDir + "/second " + testDir + "/third").c_str()) == 0);
+    writeBareRepository(testDir + "/remote.git");
+
+    // Download a module into the first project (populating the source cache)
+    auto firstDownloadSettings = DownloadSettings(testDir + "/first/download", testDir + "/first/raw");
+    firstDownloadSettings.setSourceCache(testDir + "/sources");
+    REQUIRE (firstDownloadSettings.addModule("lib", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", "v1"}}));
+    REQUIRE (firstDownloadSettings.download());
+    REQUIRE (ExecShell::exec("ls " + testDir + "/sources/git | wc -l") == "1\n");
+
+    // Verify the module was materialized from the (read-only) cache using hardlinks
+    REQUIRE (ExecShell::exec("cat " + testDir + "/first/raw/lib/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("stat -c %h " + testDir + "/first/raw/lib/version.txt") == "2\n");
+    REQUIRE (ExecShell::exec("stat -c %A " + testDir + "/first/raw/lib/version.txt") == "-r--r--r--\n");
+
+    // Remove the remote repository so only the cache can resolve the module
+    REQUIRE (system(std::string("rm -rf " + testDir + "/remote.git*").c_str()) == 0);
+
+    // Verify a second project resolves the cached module offline
+    auto secondDownloadSettings = DownloadSettings(testDir + "/second/download", testDir + "/second/raw");
+    secondDownloadSettings.setSourceCache(testDir + "/sources", true);
+    REQUIRE (secondDownloadSettings.addModule("lib", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", "v1"}}));
+    REQUIRE (secondDownloadSettings.download());
+    REQUIRE (ExecShell::exec("cat " + testDir + "/second/raw/lib/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("stat -c %h " + testDir + "/second/raw/lib/version.txt") == "3\n");
+
+    // Verify modules missing from the cache cannot be resolved offline
+    auto thirdDownloadSettings = DownloadSettings(testDir + "/third/download", testDir + "/third/raw");
+    thirdDownloadSettings.setSourceCache(testDir + "/sources", true);
+    REQUIRE (thirdDownloadSettings.addModule("lib", {{"type", "git"}, {"url", "file://" + testDir + "/remote.git"},
+            {"rev", "v2"}}));
+    REQUIRE (!thirdDownloadSettings.download());
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("chmod -R u+w " + testDir + " && rm -rf " + testDir).c_str()) == 0);
+}
+
+TEST_CASE ("Sparse Partial Git Download Settings Test", "[DownloadSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    std::string testDir = "/tmp/higgs-boson/download-test";
+    REQUIRE (system(std::string("mkdir -p " + testDir).c_str()) == 0);
+
+    // Create a (bare) monorepo allowing partial clones with a few subdirectories
+    std::string workPath = testDir + "/monorepo.work";
+    REQUIRE (system(std::string("git init -q --bare " + testDir + "/monorepo.git"
+            + " && git -C " + testDir + "/monorepo.git config uploadpack.allowFilter true"
+            + " && git init -q " + workPath + " && cd " + workPath
+            + " && mkdir -p libs/first libs/second/nested && echo first > libs/first/lib.txt"
+            + " && echo second > libs/second/nested/lib.txt && echo top > top.txt && git add -A"
+            + " && git -c user.name=test -c user.email=test@test.com commit -q -m v1 && git tag v1"
+            + " && git push -q --tags " + testDir + "/monorepo.git HEAD:refs/heads/master").c_str()) == 0);
+
+    // Setup the download settings with sparse, partial, and sparse partial modules
+    auto downloadSettings = DownloadSettings(testDir + "/download", testDir + "/raw");
+    std::string url = "file://" + testDir + "/monorepo.git";
+    REQUIRE (downloadSettings.addModule("sparse", {{"type", "git"}, {"url", url}, {"rev", "v1"},
+            {"paths", "/libs/first/,top.txt"}}));
+    REQUIRE (downloadSettings.addModule("partial", {{"type", "git"}, {"url", url}, {"rev", "v1"},
+            {"filter", "blob:none"}}));
+    REQUIRE (downloadSettings.addModule("sparsepartial", {{"type", "git"}, {"url", url}, {"rev", "v1"},
+            {"paths", "/libs/second/"}, {"filter", "blob:none"}}));
+
+    // Download the modules and verify only the sparse paths were written
+    REQUIRE (downloadSettings.download());
+    REQUIRE (ExecShell::exec("cd " + testDir + "/raw/sparse && find . -type f | sort")
+            == "./libs/first/lib.txt\n./top.txt\n");
+    REQUIRE (ExecShell::exec("cd " + testDir + "/raw/partial && find . -type f | sort")
+            == "./libs/first/lib.txt\n./libs/second/nested/lib.txt\n./top.txt\n");
+    REQUIRE (ExecShell::exec("cd " + testDir + "/raw/sparsepartial && find . -type f | sort")
+            == "./libs/second/nested/lib.txt\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/raw/sparsepartial/libs/second/nested/lib.txt") == "second\n");
+    REQUIRE (ExecShell::exec("ls -A " + testDir + "/raw") == "partial\nsparse\nsparsepartial\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf " + testDir).c_str()) == 0);
+}
+
+TEST_CASE ("Checksummed Curl Download Settings Test", "[DownloadSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    std::string testDir = "/tmp/higgs-boson/download-test";
+    REQUIRE (system(std::string("mkdir -p " + testDir + "/served/lib " + testDir + "/first " + testDir + "/second").c_str()) == 0);
+
+    // Create the archives to serve (and a partial download of one of them to resume)
+    REQUIRE (system(std::string("cd " + testDir + "/served && echo v1 > lib/version.txt"
+            + " && tar -czf lib.tar.gz lib && tar -cJf lib.tar.xz lib && zip -qr lib.zip lib"
+            + " && mkdir -p " + testDir + "/first/raw/.gzlib.download"
+            + " && head -c 20 lib.tar.gz > " + testDir + "/first/raw/.gzlib.download/lib.tar.gz.part").c_str()) == 0);
+    auto sha256 = ExecShell::exec("sha256sum < " + testDir + "/served/lib.tar.gz | cut -d' ' -f1 | tr -d '\\n'");
+    REQUIRE (sha256.size() == 64);
+    REQUIRE (serveDirectory(testDir + "/served", "18093"));
+
+    // Download the archives (verifying the checksum and caching the checksummed one)
+    std::string url = "http://127.0.0.1:18093/";
+    auto firstDownloadSettings = DownloadSettings(testDir + "/first/download", testDir + "/first/raw");
+    firstDownloadSettings.setSourceCache(testDir + "/sources");
+    REQUIRE (firstDownloadSettings.addModule("gzlib", {{"type", "curl"}, {"url", url + "lib.tar.gz"},
+            {"unpack", "tar"}, {"sha256", sha256}}));
+    REQUIRE (firstDownloadSettings.addModule("xzlib", {{"type", "curl"}, {"url", url + "lib.tar.xz"},
+            {"unpack", "tar"}}));
+    REQUIRE (firstDownloadSettings.addModule("ziplib", {{"type", "curl"}, {"url", url + "lib.zip"},
+            {"unpack", "zip"}}));
+    REQUIRE (firstDownloadSettings.addModule("plain", {{"type", "curl"}, {"url", url + "lib/version.txt"}}));
+    REQUIRE (firstDownloadSettings.download());
+    REQUIRE (ExecShell::exec("cat " + testDir + "/first/raw/gzlib/lib/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/first/raw/xzlib/lib/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/first/raw/ziplib/lib/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("cat " + testDir + "/first/raw/plain/version.txt") == "v1\n");
+    REQUIRE (ExecShell::exec("ls -A " + testDir + "/first/raw") == "gzlib\nplain\nxzlib\nziplib\n");
+    REQUIRE (ExecShell::exec("ls " + testDir + "/sources/archives/" + sha256) == "lib.tar.gz\n");
+
+    // Verify a mismatching checksum fails the download
+    auto secondDownloadSettings = DownloadSettings(testDir + "/second/download", testDir + "/second/raw");
+    secondDownloadSettings.setRetries(1);
+    REQUIRE (secondDownloadSettings.addModule("gzlib", {{"type", "curl"}, {"url", url + "lib.tar.gz"},
+            {"unpack", "tar"}, {"sha256", std::string(64, '0')}}));
+    REQUIRE (!secondDownloadSettings.download());
+    REQUIRE (ExecShell::exec("cat " + testDir + "/second/download.status/gzlib") == "FAILED\n");
+    REQUIRE (ExecShell::exec("ls " + testDir + "/second/raw") == "");
+
+    // Stop the server so only the cache can resolve the checksummed archive
+    REQUIRE (system(std::string("kill $(cat " + testDir + "/served.pid)").c_str()) == 0);
+
+    // Verify the cached archive is extracted again offline
+    REQUIRE (system(std::string("rm -rf " + testDir + "/first/raw").c_str()) == 0);
+    auto thirdDownloadSettings = DownloadSettings(testDir + "/first/download", testDir + "/first/raw");
+    thirdDownloadSettings.setSourceCache(testDir + "/sources", true);
+    REQUIRE (thirdDownloadSettings.addModule("gzlib", {{"type", "curl"}, {"url", url + "lib.tar.gz"},
+            {"unpack", "tar"}, {"sha256", sha256}}));
+    REQUIRE (thirdDownloadSettings.download());
+    REQUIRE (ExecShell::exec("cat " + testDir + "/first/raw/gzlib/lib/version.txt") == "v1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf " + testDir).c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_DOWNLOAD_SETTINGS_TEST_HPP
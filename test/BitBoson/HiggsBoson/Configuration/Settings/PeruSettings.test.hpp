@@ -67,7 +67,49 @@ TEST_CASE ("Generic Peru Settings Test", "[PeruSettingsTest]")
     REQUIRE (ExecShell::exec("sha256sum " + readmePath) == (readmeHash + "  " + readmePath + "\n"));
 
     // Cleanup the temporary files
-    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru.yaml").c_str()) == 0);
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru.yaml*").c_str()) == 0);
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru-sync").c_str()) == 0);
+}
+
+TEST_CASE ("Locked Peru Settings Test", "[PeruSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/peru-sync").c_str()) == 0);
+
+    // Create a Peru Settings object for testing
+    std::string peruFile = "/tmp/higgs-boson/peru.yaml";
+    std::string peruSyncDir = "/tmp/higgs-boson/peru-sync";
+    auto peruSettings = PeruSettings(peruFile, peruSyncDir);
+
+    // Setup the Peru settings with a git dependency
+    REQUIRE (peruSettings.addDependency("miniyaml", PeruSettings::DependencyType::TYPE_GIT));
+    REQUIRE (peruSettings.addDependencyProperty("miniyaml", "url", "https://github.com/bitboson-deps/mini-yaml.git"));
+    REQUIRE (peruSettings.addDependencyProperty("miniyaml", "rev", "22d3dcf5684a11f9c0508c1ad8b3282a1d888319"));
+
+    // Run a Peru sync to download the dependency and verify it was locked
+    REQUIRE (peruSettings.peruSync());
+    REQUIRE (ExecShell::exec("grep -c '^git module' " + peruFile + ".lock") == "3\n");
+    REQUIRE (ExecShell::exec("grep -c '^ tree: [0-9a-f]\\{64\\}$' " + peruFile + ".lock") == "3\n");
+
+    // Verify a re-sync without any changes is skipped
+    REQUIRE (system(std::string("rm " + peruFile + ".sync.sh").c_str()) == 0);
+    REQUIRE (peruSettings.peruSync());
+    REQUIRE (ExecShell::exec("ls " + peruFile + ".sync.sh 2> /dev/null || true").empty());
+
+    // Modify the synced files of the dependency
+    std::string headerPath = peruSyncDir + "/miniyaml/yaml/Yaml.hpp";
+    REQUIRE (system(std::string("echo '// Modified' >> " + headerPath).c_str()) == 0);
+
+    // Verify only the modified dependency is re-synced (restoring its files)
+    REQUIRE (peruSettings.peruSync());
+    REQUIRE (ExecShell::exec("grep -c ' copy ' " + peruFile + ".sync.sh") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c ' copy miniyaml ' " + peruFile + ".sync.sh") == "1\n");
+    std::string headerHash = "e645fe459683c91a61624527e9f460c1a62bf8a1ff9ea47cb663dc72d207ad9a";
+    REQUIRE (ExecShell::exec("sha256sum " + headerPath) == (headerHash + "  " + headerPath + "\n"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru.yaml*").c_str()) == 0);
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru-sync").c_str()) == 0);
 }
 
@@ -107,8 +149,53 @@ TEST_CASE ("Invalid Peru Settings Test", "[PeruSettingsTest]")
     REQUIRE (ExecShell::exec("sha256sum " + headerPath) == (headerHash + "  " + headerPath + "\n"));
 
     // Cleanup the temporary files
-    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru.yaml").c_str()) == 0);
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru.yaml*").c_str()) == 0);
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru-sync").c_str()) == 0);
+}
+
+TEST_CASE ("Offline Peru Settings Test", "[PeruSettingsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/peru-sync").c_str()) == 0);
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/peru-cache").c_str()) == 0);
+
+    // Create an offline Peru Settings object (with an initially empty source cache) for testing
+    std::string peruFile = "/tmp/higgs-boson/peru.yaml";
+    std::string peruSyncDir = "/tmp/higgs-boson/peru-sync";
+    auto peruSettings = PeruSettings(peruFile, peruSyncDir);
+    peruSettings.setSourceCache("/tmp/higgs-boson/peru-cache", true);
+
+    // Setup the Peru settings with a git dependency
+    REQUIRE (peruSettings.addDependency("miniyaml", PeruSettings::DependencyType::TYPE_GIT));
+    REQUIRE (peruSettings.addDependencyProperty("miniyaml", "url", "https://github.com/bitboson-deps/mini-yaml.git"));
+    REQUIRE (peruSettings.addDependencyProperty("miniyaml", "rev", "22d3dcf5684a11f9c0508c1ad8b3282a1d888319"));
+
+    // Verify the sync fails without ever running Peru (or reaching the network)
+    REQUIRE (!peruSettings.peruSync());
+    REQUIRE (ExecShell::exec("ls " + peruFile + ".sync.sh 2> /dev/null || true").empty());
+    REQUIRE (ExecShell::exec("ls " + peruSyncDir + "/miniyaml 2> /dev/null || true").empty());
+
+    // Run an online Peru sync (with the default backend) to populate the source cache
+    auto onlinePeruSettings = PeruSettings(peruFile, peruSyncDir);
+    onlinePeruSettings.setSourceCache("/tmp/higgs-boson/peru-cache");
+    REQUIRE (onlinePeruSettings.addDependency("miniyaml", PeruSettings::DependencyType::TYPE_GIT));
+    REQUIRE (onlinePeruSettings.addDependencyProperty("miniyaml", "url", "https://github.com/bitboson-deps/mini-yaml.git"));
+    REQUIRE (onlinePeruSettings.addDependencyProperty("miniyaml", "rev", "22d3dcf5684a11f9c0508c1ad8b3282a1d888319"));
+    REQUIRE (onlinePeruSettings.peruSync());
+    REQUIRE (ExecShell::exec("ls /tmp/higgs-boson/peru-cache/git | wc -l") == "3\n");
+
+    // Verify an offline sync (of the removed modules) is now resolved from the source cache
+    REQUIRE (system(std::string("rm -rf " + peruSyncDir).c_str()) == 0);
+    REQUIRE (peruSettings.peruSync());
+    std::string headerPath = peruSyncDir + "/miniyaml/yaml/Yaml.hpp";
+    std::string headerHash = "e645fe459683c91a61624527e9f460c1a62bf8a1ff9ea47cb663dc72d207ad9a";
+    REQUIRE (ExecShell::exec("sha256sum " + headerPath) == (headerHash + "  " + headerPath + "\n"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru.yaml*").c_str()) == 0);
     REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru-sync").c_str()) == 0);
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/peru-cache").c_str()) == 0);
 }
 
 #endif //HIGGS_BOSON_PERU_SETTINGS_TEST_HPP
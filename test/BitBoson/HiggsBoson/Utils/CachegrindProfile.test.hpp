@@ -0,0 +1,116 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_CACHEGRIND_PROFILE_TEST_HPP
+#define HIGGS_BOSON_CACHEGRIND_PROFILE_TEST_HPP
+
+#include <sstream>
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
+#include <BitBoson/HiggsBoson/Utils/CachegrindProfile.h>
+
+using namespace BitBoson;
+
+/**
+ * Helper function used to get sample cachegrind output of a column-major
+ * traversal (missing the cache) alongside a row-major traversal
+ *
+ * @return String representing the sample cachegrind output
+ */
+std::string getSampleCachegrindOutput()
+{
+
+    // Create the sample cachegrind output (with omitted trailing zero counts)
+    return std::string("desc: I1 cache:         32768 B, 64 B, 8-way associative\n")
+            + "desc: D1 cache:         32768 B, 64 B, 8-way associative\n"
+            + "desc: LL cache:         8388608 B, 64 B, 16-way associative\n"
+            + "cmd: bin/test-proj_test\n"
+            + "events: Ir I1mr ILmr Dr D1mr DLmr Dw D1mw DLmw\n"
+            + "fl=/tmp/src/Matrix.cpp\n"
+            + "fn=sumColumns(Matrix const&)\n"
+            + "10 100 1 1 1000 500 100 10 0 0\n"
+            + "11 50 0 0 200 100\n"
+            + "fn=sumRows(Matrix const&)\n"
+            + "20 100 0 0 1000 10 1\n"
+            + "fl=/tmp/src/main.cpp\n"
+            + "fn=main\n"
+            + "5 10 1 1 2 0 0 2 1 1\n"
+            + "summary: 260 2 2 2202 610 101 12 1 1\n";
+}
+
+TEST_CASE ("Aggregate Cachegrind Profile Test", "[CachegrindProfileTest]")
+{
+
+    // Read-in the sample cachegrind output
+    CachegrindProfile cachegrindProfile;
+    std::istringstream outputStream(getSampleCachegrindOutput());
+    cachegrindProfile.readCachegrindOutput(outputStream);
+
+    // Verify the total data accesses and misses
+    REQUIRE (cachegrindProfile.getTotals().accesses == 2214);
+    REQUIRE (cachegrindProfile.getTotals().l1Misses == 611);
+    REQUIRE (cachegrindProfile.getTotals().llMisses == 102);
+
+    // Verify the functions were ordered by their first-level misses
+    auto functions = cachegrindProfile.getFunctions();
+    REQUIRE (functions.size() == 3);
+    REQUIRE (functions[0].name == "sumColumns(Matrix const&)");
+    REQUIRE (functions[0].accesses == 1210);
+    REQUIRE (functions[0].l1Misses == 600);
+    REQUIRE (functions[0].llMisses == 100);
+    REQUIRE (functions[1].name == "sumRows(Matrix const&)");
+    REQUIRE (functions[2].name == "main");
+
+    // Verify the misses were mapped back to their source lines
+    auto sourceLines = cachegrindProfile.getSourceLines();
+    REQUIRE (sourceLines.size() == 4);
+    REQUIRE (sourceLines[0].name == "/tmp/src/Matrix.cpp:10");
+    REQUIRE (sourceLines[0].l1Misses == 500);
+    REQUIRE (sourceLines[1].name == "/tmp/src/Matrix.cpp:11");
+    REQUIRE (sourceLines[1].accesses == 200);
+    REQUIRE (sourceLines[3].name == "/tmp/src/main.cpp:5");
+    REQUIRE (sourceLines[3].llMisses == 1);
+}
+
+TEST_CASE ("Write Cachegrind Profile Test", "[CachegrindProfileTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/cachegrind-test").c_str()) == 0);
+
+    // Write-out the sample cachegrind output and read it back in
+    CachegrindProfile cachegrindProfile;
+    REQUIRE (!cachegrindProfile.readCachegrindOutput("/tmp/higgs-boson/cachegrind-test/missing.cachegrind"));
+    std::ofstream outputFile("/tmp/higgs-boson/cachegrind-test/cache.1.cachegrind");
+    outputFile << getSampleCachegrindOutput();
+    outputFile.close();
+    REQUIRE (cachegrindProfile.readCachegrindOutput("/tmp/higgs-boson/cachegrind-test/cache.1.cachegrind"));
+
+    // Verify the report was written with the miss ratios
+    REQUIRE (cachegrindProfile.writeReport("/tmp/higgs-boson/cachegrind-test/cache.txt"));
+    REQUIRE (ExecShell::exec("grep -c '49.59%.*8.26%  sumColumns' /tmp/higgs-boson/cachegrind-test/cache.txt") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '49.50%.*9.90%  /tmp/src/Matrix.cpp:10$' /tmp/higgs-boson/cachegrind-test/cache.txt") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/cachegrind-test").c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_CACHEGRIND_PROFILE_TEST_HPP
@@ -0,0 +1,96 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_FLAME_GRAPH_TEST_HPP
+#define HIGGS_BOSON_FLAME_GRAPH_TEST_HPP
+
+#include <sstream>
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
+#include <BitBoson/HiggsBoson/Utils/FlameGraph.h>
+
+using namespace BitBoson;
+
+TEST_CASE ("Fold Sampled Perf Script Flame Graph Test", "[FlameGraphTest]")
+{
+
+    // Create the sample (leaf-first) perf script output
+    std::string sampleScript = std::string("  test-proj_test   100 1000.000100000: cycles: \n")
+            + "\tffffffff81000001 page_fault ([kernel.kallsyms])\n"
+            + "\t    555500000001 compute+0x1a (/tmp/bin/test-proj_test)\n"
+            + "\t    555500000002 main+0x10 (/tmp/bin/test-proj_test)\n\n"
+            + "  test-proj_test   100 1000.000200000: cycles: \n"
+            + "\t    555500000001 compute+0x2b (/tmp/bin/test-proj_test)\n"
+            + "\t    555500000002 main+0x10 (/tmp/bin/test-proj_test)\n\n"
+            + "  test-proj_test   100 1000.000300000: cycles: \n"
+            + "\t    555500000001 compute+0x2b (/tmp/bin/test-proj_test)\n"
+            + "\t    555500000002 main+0x10 (/tmp/bin/test-proj_test)\n";
+
+    // Read-in the sample perf script output
+    FlameGraph flameGraph;
+    std::istringstream scriptStream(sampleScript);
+    flameGraph.readPerfScript(scriptStream);
+    REQUIRE (flameGraph.getTotalCount() == 3);
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/flame-graph-test").c_str()) == 0);
+
+    // Verify the stacks were folded root-first (without offsets)
+    REQUIRE (flameGraph.writeFoldedStacks("/tmp/higgs-boson/flame-graph-test/perf.folded"));
+    REQUIRE (ExecShell::exec("cat /tmp/higgs-boson/flame-graph-test/perf.folded")
+            == "test-proj_test;main;compute 2\ntest-proj_test;main;compute;page_fault_[k] 1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/flame-graph-test").c_str()) == 0);
+}
+
+TEST_CASE ("Write Flame Graph Test", "[FlameGraphTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/flame-graph-test").c_str()) == 0);
+
+    // Write-out the folded stacks and read them back in
+    FlameGraph flameGraph;
+    REQUIRE (!flameGraph.readFoldedStacks("/tmp/higgs-boson/flame-graph-test/missing.folded"));
+    std::ofstream foldedFile("/tmp/higgs-boson/flame-graph-test/heap.folded");
+    foldedFile << "test-proj;main;std::vector<int> alloc 3\n";
+    foldedFile << "test-proj;main;operator new 1\n";
+    foldedFile << "test-proj;main;std::vector<int> alloc 4\n";
+    foldedFile.close();
+    REQUIRE (flameGraph.readFoldedStacks("/tmp/higgs-boson/flame-graph-test/heap.folded"));
+    REQUIRE (flameGraph.getTotalCount() == 8);
+
+    // Verify the flame graph was written with the merged (escaped) frames
+    REQUIRE (flameGraph.writeSvg("/tmp/higgs-boson/flame-graph-test/heap.svg", "Heap Flame Graph", "allocations", "mem"));
+    std::string svgPath = "/tmp/higgs-boson/flame-graph-test/heap.svg";
+    REQUIRE (ExecShell::exec("grep -c '<svg' " + svgPath) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '<title>all (8 allocations, 100.00%)</title>' " + svgPath) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '<title>main (8 allocations, 100.00%)</title>' " + svgPath) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '<title>std::vector&lt;int&gt; alloc (7 allocations, 87.50%)</title>' "
+            + svgPath) == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '<title>operator new (1 allocations, 12.50%)</title>' " + svgPath) == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/flame-graph-test").c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_FLAME_GRAPH_TEST_HPP
@@ -0,0 +1,102 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_INCLUDE_GRAPH_TEST_HPP
+#define HIGGS_BOSON_INCLUDE_GRAPH_TEST_HPP
+
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/IncludeGraph.h>
+
+using namespace BitBoson;
+
+TEST_CASE ("Resolve Include Graph Test", "[IncludeGraphTest]")
+{
+
+    // Setup a project whose headers include each other (with a cycle)
+    std::string projectDir = "/tmp/higgs-boson/include-graph-test";
+    REQUIRE (system(std::string("mkdir -p " + projectDir + "/src/Math " + projectDir + "/test"
+            + " && printf '#include <Math/Vector.h>\\n#include <vector>\\n' > " + projectDir + "/src/Math/Matrix.h"
+            + " && printf '#include \"Scalar.h\"\\n' > " + projectDir + "/src/Math/Vector.h"
+            + " && printf '  #  include \"Vector.h\"\\n' > " + projectDir + "/src/Math/Scalar.h"
+            + " && printf '#include <Math/Matrix.h>\\n' > " + projectDir + "/test/Matrix.test.hpp").c_str()) == 0);
+
+    // Build the include graph for the test file
+    IncludeGraph includeGraph;
+    includeGraph.addIncludeDir(projectDir + "/src");
+    includeGraph.addIncludeDir(projectDir + "/test");
+    REQUIRE (includeGraph.addFile(projectDir + "/test/Matrix.test.hpp"));
+    REQUIRE (!includeGraph.addFile(projectDir + "/test/Missing.test.hpp"));
+
+    // Verify the direct includes were resolved (skipping system headers)
+    auto includes = includeGraph.getIncludes(projectDir + "/src/Math/Matrix.h");
+    REQUIRE (includes.size() == 1);
+    REQUIRE (includes[0] == projectDir + "/src/Math/Vector.h");
+
+    // Verify the transitive includes were resolved (despite the cycle)
+    auto dependencies = includeGraph.getDependencies(projectDir + "/test/./Matrix.test.hpp");
+    REQUIRE (dependencies.size() == 3);
+    REQUIRE (dependencies[0] == projectDir + "/src/Math/Matrix.h");
+    REQUIRE (dependencies[1] == projectDir + "/src/Math/Scalar.h");
+    REQUIRE (dependencies[2] == projectDir + "/src/Math/Vector.h");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf " + projectDir).c_str()) == 0);
+}
+
+TEST_CASE ("Affected Include Graph Test", "[IncludeGraphTest]")
+{
+
+    // Setup a project with two independent test files
+    std::string projectDir = "/tmp/higgs-boson/include-graph-test";
+    REQUIRE (system(std::string("mkdir -p " + projectDir + "/src " + projectDir + "/test"
+            + " && printf '#include <Parser.h>\\n' > " + projectDir + "/test/Parser.test.hpp"
+            + " && printf '#include <Writer.h>\\n' > " + projectDir + "/test/Writer.test.hpp"
+            + " && touch " + projectDir + "/src/Parser.h " + projectDir + "/src/Parser.cpp"
+            + " && touch " + projectDir + "/src/Writer.h " + projectDir + "/src/Writer.cpp").c_str()) == 0);
+    std::vector<std::string> testFiles = {projectDir + "/test/Parser.test.hpp", projectDir + "/test/Writer.test.hpp"};
+
+    // Build the include graph for the project
+    IncludeGraph includeGraph;
+    includeGraph.addIncludeDir(projectDir + "/src");
+
+    // Verify a changed header only affects the test files including it
+    auto affectedFiles = includeGraph.getAffectedFiles(testFiles, {projectDir + "/src/Writer.h"});
+    REQUIRE (affectedFiles.size() == 1);
+    REQUIRE (affectedFiles[0] == projectDir + "/test/Writer.test.hpp");
+
+    // Verify a changed source file affects the test files including its header
+    affectedFiles = includeGraph.getAffectedFiles(testFiles, {projectDir + "/src/Parser.cpp"});
+    REQUIRE (affectedFiles.size() == 1);
+    REQUIRE (affectedFiles[0] == projectDir + "/test/Parser.test.hpp");
+
+    // Verify a changed test file affects itself
+    affectedFiles = includeGraph.getAffectedFiles(testFiles,
+            {projectDir + "/test/Writer.test.hpp", projectDir + "/src/Parser.h"});
+    REQUIRE (affectedFiles.size() == 2);
+
+    // Verify unrelated changes affect no test files
+    REQUIRE (includeGraph.getAffectedFiles(testFiles, {projectDir + "/README.md"}).empty());
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf " + projectDir).c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_INCLUDE_GRAPH_TEST_HPP
@@ -0,0 +1,110 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_OFF_CPU_PROFILE_TEST_HPP
+#define HIGGS_BOSON_OFF_CPU_PROFILE_TEST_HPP
+
+#include <sstream>
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
+#include <BitBoson/HiggsBoson/Utils/OffCpuProfile.h>
+
+using namespace BitBoson;
+
+/**
+ * Helper function used to get sample perf script output of a thread blocking
+ * on a mutex (futex wait) alongside wake operations and a preempted thread
+ *
+ * @return String representing the sample perf script output
+ */
+std::string getSamplePerfScript()
+{
+
+    // Create the sample perf script output
+    std::string lockFrames = std::string("\t    7f0000000001 __lll_lock_wait (/usr/lib/x86_64-linux-gnu/libpthread-2.31.so)\n")
+            + "\t    555500000001 lockResource (/tmp/bin/test-proj_test)\n"
+            + "\t    555500000002 main (/tmp/bin/test-proj_test)\n";
+    return std::string("  test-proj_test   100 1000.000100000: syscalls:sys_enter_futex: uaddr: 0x00007ffd00000000, op: 0x00000080, val: 0x00000002, utime: 0x00000000, uaddr2: 0x00000000, val3: 0x00000000\n")
+            + lockFrames + "\n"
+            + "  test-proj_test   100 1000.000200000: sched:sched_switch: prev_comm=test-proj_test prev_pid=100 prev_prio=120 prev_state=S ==> next_comm=swapper/0 next_pid=0 next_prio=120\n"
+            + "\tffffffff81000001 __schedule ([kernel.kallsyms])\n"
+            + lockFrames + "\n"
+            + "          worker   200 1000.000300000: sched:sched_switch: prev_comm=worker prev_pid=200 prev_prio=120 prev_state=R+ ==> next_comm=swapper/0 next_pid=0 next_prio=120\n"
+            + "\t    555500000003 compute (/tmp/bin/test-proj_test)\n\n"
+            + "          worker   200 1000.000400000: syscalls:sys_enter_futex: uaddr: 0x00007ffd00000000, op: 0x00000081, val: 0x00000001, utime: 0x00000000, uaddr2: 0x00000000, val3: 0x00000000\n"
+            + "\t    555500000004 unlockResource (/tmp/bin/test-proj_test)\n\n"
+            + "          worker   200 1000.000500000: syscalls:sys_exit_futex: 0x1\n\n"
+            + "          worker   200 1000.005200000: sched:sched_stat_sleep: comm=test-proj_test pid=100 delay=5000000 [ns]\n\n"
+            + "          worker   200 1000.005300000: sched:sched_stat_sleep: comm=worker pid=200 delay=7000000 [ns]\n\n"
+            + "  test-proj_test   100 1000.005100000: syscalls:sys_exit_futex: 0x0\n"
+            + lockFrames;
+}
+
+TEST_CASE ("Aggregate Off-CPU Profile Test", "[OffCpuProfileTest]")
+{
+
+    // Read-in the sample perf script output
+    OffCpuProfile offCpuProfile;
+    std::istringstream scriptStream(getSamplePerfScript());
+    offCpuProfile.readPerfScript(scriptStream);
+
+    // Verify only the voluntarily blocked thread was charged with its delay
+    REQUIRE (offCpuProfile.getBlockedTime() == 5000000);
+    auto blockedStacks = offCpuProfile.getBlockedStacks();
+    REQUIRE (blockedStacks.size() == 1);
+    REQUIRE (blockedStacks[0].first == "test-proj_test;main;lockResource;__lll_lock_wait;__schedule_[k]");
+    REQUIRE (blockedStacks[0].second == 5000000);
+
+    // Verify only the futex wait was charged to its (non-system) call site
+    auto futexCallSites = offCpuProfile.getFutexCallSites();
+    REQUIRE (futexCallSites.size() == 1);
+    REQUIRE (futexCallSites[0].name == "lockResource");
+    REQUIRE (futexCallSites[0].waitTime == 5000000);
+    REQUIRE (futexCallSites[0].waitCount == 1);
+}
+
+TEST_CASE ("Write Off-CPU Profile Test", "[OffCpuProfileTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/off-cpu-test").c_str()) == 0);
+
+    // Write-out the sample perf script output and read it back in
+    OffCpuProfile offCpuProfile;
+    REQUIRE (!offCpuProfile.readPerfScript("/tmp/higgs-boson/off-cpu-test/missing.script"));
+    std::ofstream scriptFile("/tmp/higgs-boson/off-cpu-test/offcpu.script");
+    scriptFile << getSamplePerfScript();
+    scriptFile.close();
+    REQUIRE (offCpuProfile.readPerfScript("/tmp/higgs-boson/off-cpu-test/offcpu.script"));
+
+    // Verify the folded stacks and report were written
+    REQUIRE (offCpuProfile.writeFoldedStacks("/tmp/higgs-boson/off-cpu-test/offcpu.folded"));
+    REQUIRE (ExecShell::exec("cat /tmp/higgs-boson/off-cpu-test/offcpu.folded")
+            == "test-proj_test;main;lockResource;__lll_lock_wait;__schedule_[k] 5000000\n");
+    REQUIRE (offCpuProfile.writeReport("/tmp/higgs-boson/off-cpu-test/offcpu.txt"));
+    REQUIRE (ExecShell::exec("grep -c 'Total blocked time: 5.000 ms' /tmp/higgs-boson/off-cpu-test/offcpu.txt") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c '1 waits  lockResource' /tmp/higgs-boson/off-cpu-test/offcpu.txt") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/off-cpu-test").c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_OFF_CPU_PROFILE_TEST_HPP
@@ -0,0 +1,114 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_PERF_COUNTERS_TEST_HPP
+#define HIGGS_BOSON_PERF_COUNTERS_TEST_HPP
+
+#include <regex>
+#include <sstream>
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
+#include <BitBoson/HiggsBoson/Utils/PerfCounters.h>
+
+using namespace BitBoson;
+
+/**
+ * Helper function used to get sample perf stat output from a hybrid processor
+ * (split first-level cache counters) without last-level cache counters
+ *
+ * @return String representing the sample perf stat output
+ */
+std::string getSamplePerfStat()
+{
+
+    // Create the sample perf stat output
+    return std::string("# started on Mon Oct 19 10:00:00 2026\n\n")
+            + "2000000,,cycles:u,1000000,100.00,,\n"
+            + "3000000,,instructions:u,1000000,100.00,1.50,insn per cycle\n"
+            + "500000,,branches:u,1000000,100.00,,\n"
+            + "5000,,branch-misses:u,1000000,100.00,1.00,of all branches\n"
+            + "800000,,cpu_core/L1-dcache-loads/u,1000000,100.00,,\n"
+            + "200000,,cpu_atom/L1-dcache-loads/u,1000000,100.00,,\n"
+            + "100000,,cpu_core/L1-dcache-load-misses/u,1000000,100.00,12.50,of all L1-dcache accesses\n"
+            + "<not supported>,,LLC-loads:u,0,100.00,,\n"
+            + "<not counted>,,LLC-load-misses:u,0,0.00,,\n"
+            + "12,,context-switches:u,1000000,100.00,12.000,/sec\n";
+}
+
+TEST_CASE ("Read Perf Counters Test", "[PerfCountersTest]")
+{
+
+    // Read-in the sample perf stat output
+    PerfCounters perfCounters;
+    std::istringstream outputStream(getSamplePerfStat());
+    perfCounters.readPerfStat(outputStream);
+
+    // Verify the counters were normalized (and summed) by event
+    REQUIRE (perfCounters.getCounter("cycles") == 2000000);
+    REQUIRE (perfCounters.getCounter("instructions") == 3000000);
+    REQUIRE (perfCounters.getCounter("L1-dcache-loads") == 1000000);
+    REQUIRE (perfCounters.getCounter("context-switches") == 12);
+    REQUIRE (!perfCounters.hasCounter("LLC-loads"));
+    REQUIRE (!perfCounters.hasCounter("LLC-load-misses"));
+
+    // Verify the derived metrics
+    REQUIRE (perfCounters.getRatio("instructions", "cycles") == Approx(1.5));
+    REQUIRE (perfCounters.getRatio("branch-misses", "branches") == Approx(0.01));
+    REQUIRE (perfCounters.getRatio("L1-dcache-load-misses", "L1-dcache-loads") == Approx(0.1));
+    REQUIRE (perfCounters.getRatio("LLC-load-misses", "LLC-loads") == Approx(0.0));
+
+    // Verify the summary reports the metrics (and the events not counted)
+    auto summary = perfCounters.getSummary();
+    REQUIRE (std::regex_search(summary, std::regex("ipc +1\\.50\n")));
+    REQUIRE (std::regex_search(summary, std::regex("branch-miss-rate +1\\.00%\n")));
+    REQUIRE (std::regex_search(summary, std::regex("L1-dcache-miss-rate +10\\.00%\n")));
+    REQUIRE (std::regex_search(summary, std::regex("LLC-miss-rate +not counted\n")));
+}
+
+TEST_CASE ("Append Perf Counters Metrics Test", "[PerfCountersTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/perf-counters-test").c_str()) == 0);
+
+    // Write-out the sample perf stat output and read it back in
+    PerfCounters perfCounters;
+    REQUIRE (!perfCounters.readPerfStat("/tmp/higgs-boson/perf-counters-test/missing.csv"));
+    std::ofstream outputFile("/tmp/higgs-boson/perf-counters-test/counters.csv");
+    outputFile << getSamplePerfStat();
+    outputFile.close();
+    REQUIRE (perfCounters.readPerfStat("/tmp/higgs-boson/perf-counters-test/counters.csv"));
+
+    // Append the metrics for two revisions and verify the history
+    std::string metricsPath = "/tmp/higgs-boson/perf-counters-test/metrics.tsv";
+    REQUIRE (perfCounters.appendMetrics(metricsPath, "abc1234"));
+    REQUIRE (perfCounters.appendMetrics(metricsPath, "def5678-dirty"));
+    REQUIRE (ExecShell::exec("wc -l < " + metricsPath) == "3\n");
+    REQUIRE (ExecShell::exec("head -n 1 " + metricsPath + " | cut -f 1-4,15") == "timestamp\trevision\tcycles\tinstructions\tLLC-miss-rate\n");
+    REQUIRE (ExecShell::exec("tail -n 2 " + metricsPath + " | cut -f 2-4,12-15")
+            == "abc1234\t2000000\t3000000\t1.5000\t0.0100\t0.1000\t-\n"
+               "def5678-dirty\t2000000\t3000000\t1.5000\t0.0100\t0.1000\t-\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/perf-counters-test").c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_PERF_COUNTERS_TEST_HPP
@@ -0,0 +1,143 @@
+/* This file is part of higgs-boson.
+ *
+ * Copyright (c) BitBoson
+ *
+ * higgs-boson is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * higgs-boson is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with higgs-boson.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ * Written by:
+ *     - Tyler Parcell <OriginLegend>
+ */
+
+#ifndef HIGGS_BOSON_TIME_TRACE_PROFILE_TEST_HPP
+#define HIGGS_BOSON_TIME_TRACE_PROFILE_TEST_HPP
+
+#include <sstream>
+#include <catch.hpp>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
+#include <BitBoson/HiggsBoson/Utils/TimeTraceProfile.h>
+
+using namespace BitBoson;
+
+/**
+ * Helper function used to get a sample (single-line) clang time-trace of a
+ * translation unit including the given header and instantiating the given template
+ *
+ * @param header String representing the included header
+ * @param templateName String representing the instantiated template
+ * @param totalTime Integer representing the total compile time (in microseconds)
+ * @return String representing the sample time-trace
+ */
+std::string getSampleTimeTrace(const std::string& header, const std::string& templateName, int totalTime)
+{
+
+    // Create the sample time-trace
+    return std::string("{\"traceEvents\":[")
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":10,\"dur\":4000,\"name\":\"Source\",\"args\":{\"detail\":\"" + header + "\"}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":20,\"dur\":1000,\"name\":\"Source\",\"args\":{\"detail\":\"/usr/include/c++/string\"}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":5000,\"dur\":3000,\"name\":\"InstantiateClass\",\"args\":{\"detail\":\"" + templateName + "\"}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":9000,\"dur\":500,\"name\":\"CodeGen Function\",\"args\":{\"detail\":\"foo\"}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":9600,\"dur\":250,\"name\":\"OptFunction\",\"args\":{\"detail\":\"_Z3foov\"}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":0,\"dur\":" + std::to_string(totalTime) + ",\"name\":\"ExecuteCompiler\"},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":0,\"dur\":" + std::to_string(totalTime) + ",\"name\":\"Total ExecuteCompiler\",\"args\":{\"count\":1,\"avg ms\":1}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":0,\"dur\":8500,\"name\":\"Total Frontend\",\"args\":{\"count\":1,\"avg ms\":8}},"
+            + "{\"pid\":1,\"tid\":1,\"ph\":\"X\",\"ts\":0,\"dur\":1500,\"name\":\"Total Backend\",\"args\":{\"count\":1,\"avg ms\":1}},"
+            + "{\"cat\":\"\",\"pid\":1,\"tid\":0,\"ts\":0,\"ph\":\"M\",\"name\":\"process_name\",\"args\":{\"name\":\"clang-14\"}}"
+            + "],\"beginningOfTime\":1690000000000000}\n";
+}
+
+TEST_CASE ("Aggregate Time-Trace Profile Test", "[TimeTraceProfileTest]")
+{
+
+    // Read-in the sample time-traces of two translation units
+    TimeTraceProfile timeTraceProfile;
+    std::istringstream firstTrace(getSampleTimeTrace("/usr/include/c++/map", "std::map<std::string, int>", 10000));
+    std::istringstream secondTrace(getSampleTimeTrace("/usr/include/c++/regex", "std::basic_regex<char>", 25000));
+    REQUIRE (timeTraceProfile.readTimeTrace(firstTrace, "src/TestProj/helper.cpp"));
+    REQUIRE (timeTraceProfile.readTimeTrace(secondTrace, "src/TestProj/main.cpp"));
+
+    // Verify a non time-trace (or malformed) JSON is rejected
+    std::istringstream otherJson("{\"version\": 1, \"configurations\": [1, 2]}");
+    std::istringstream malformedJson("{\"traceEvents\":[{\"ph\":\"X\"");
+    REQUIRE (!timeTraceProfile.readTimeTrace(otherJson, "CMakeFiles/other.json"));
+    REQUIRE (!timeTraceProfile.readTimeTrace(malformedJson, "CMakeFiles/malformed.json"));
+
+    // Verify the translation units were ordered by their total time
+    auto units = timeTraceProfile.getTranslationUnits();
+    REQUIRE (units.size() == 2);
+    REQUIRE (units[0].name == "src/TestProj/main.cpp");
+    REQUIRE (units[0].totalTime == Approx(25.0));
+    REQUIRE (units[0].frontendTime == Approx(8.5));
+    REQUIRE (units[0].backendTime == Approx(1.5));
+
+    // Verify the headers were aggregated across the translation units
+    auto headers = timeTraceProfile.getHeaders();
+    REQUIRE (headers.size() == 3);
+    REQUIRE (headers[2].name == "/usr/include/c++/string");
+    REQUIRE (headers[2].totalTime == Approx(2.0));
+    REQUIRE (headers[2].count == 2);
+
+    // Verify the template instantiations and code generation were aggregated
+    auto templates = timeTraceProfile.getTemplates();
+    REQUIRE (templates.size() == 2);
+    REQUIRE (templates[0].totalTime == Approx(3.0));
+    auto codeGen = timeTraceProfile.getCodeGen();
+    REQUIRE (codeGen.size() == 2);
+    REQUIRE (codeGen[0].name == "foo");
+    REQUIRE (codeGen[0].totalTime == Approx(1.0));
+    REQUIRE (codeGen[0].count == 2);
+}
+
+TEST_CASE ("Time-Trace Profile Budget Test", "[TimeTraceProfileTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/time-trace-test").c_str()) == 0);
+
+    // Write-out the sample time-trace and read it back in
+    TimeTraceProfile timeTraceProfile;
+    REQUIRE (!timeTraceProfile.readTimeTrace("/tmp/higgs-boson/time-trace-test/missing.json", "missing.cpp"));
+    std::ofstream traceFile("/tmp/higgs-boson/time-trace-test/main.cpp.json");
+    traceFile << getSampleTimeTrace("/usr/include/c++/regex", "std::basic_regex<char>", 25000);
+    traceFile.close();
+    REQUIRE (timeTraceProfile.readTimeTrace("/tmp/higgs-boson/time-trace-test/main.cpp.json", "src/TestProj/main.cpp"));
+
+    // Verify the report without a budget does not list any violations
+    REQUIRE (timeTraceProfile.writeReport("/tmp/higgs-boson/time-trace-test/build.txt"));
+    REQUIRE (ExecShell::exec("grep -c '25.0           8.5           1.5  src/TestProj/main.cpp' /tmp/higgs-boson/time-trace-test/build.txt") == "1\n");
+    REQUIRE (ExecShell::exec("grep -c 'Budget violations' /tmp/higgs-boson/time-trace-test/build.txt") == "0\n");
+
+    // Verify the first matching budget rule applies (ignoring comments)
+    std::ofstream budgetFile("/tmp/higgs-boson/time-trace-test/budget.txt");
+    budgetFile << "# Generous budget for the main translation unit\n*/main.cpp 30\n* 20\n";
+    budgetFile.close();
+    REQUIRE (timeTraceProfile.readBudget("/tmp/higgs-boson/time-trace-test/budget.txt"));
+    REQUIRE (timeTraceProfile.getBudgetViolations().empty());
+
+    // Verify a translation unit exceeding its budget is reported
+    std::istringstream strictBudget("src/* 20 # strict\n");
+    TimeTraceProfile strictProfile;
+    std::istringstream strictTrace(getSampleTimeTrace("/usr/include/c++/regex", "std::basic_regex<char>", 25000));
+    REQUIRE (strictProfile.readTimeTrace(strictTrace, "src/TestProj/main.cpp"));
+    strictProfile.readBudget(strictBudget);
+    auto budgetViolations = strictProfile.getBudgetViolations();
+    REQUIRE (budgetViolations.size() == 1);
+    REQUIRE (budgetViolations[0] == "src/TestProj/main.cpp: 25.0 ms (budget 20.0 ms for src/*)");
+    REQUIRE (strictProfile.writeReport("/tmp/higgs-boson/time-trace-test/build.txt"));
+    REQUIRE (ExecShell::exec("grep -c 'Budget violations: 1' /tmp/higgs-boson/time-trace-test/build.txt") == "1\n");
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/time-trace-test").c_str()) == 0);
+}
+
+#endif //HIGGS_BOSON_TIME_TRACE_PROFILE_TEST_HPP
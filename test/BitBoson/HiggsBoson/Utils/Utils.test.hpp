@@ -24,6 +24,7 @@
 
 #include <catch.hpp>
 #include <BitBoson/HiggsBoson/Utils/Utils.h>
+#include <BitBoson/HiggsBoson/Utils/ExecShell.h>
 
 using namespace BitBoson;
 
@@ -137,4 +138,112 @@ TEST_CASE ("Split String By Delimiter Test", "[UtilsTest]")
     REQUIRE (splitString[4] == "Awesome!");
 }
 
+TEST_CASE ("Source Revision Test", "[UtilsTest]")
+{
+
+    // Ensure that the directories we'll be using exists
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/revision-test").c_str()) == 0);
+
+    // Verify directories outside of a git repository have an unknown revision
+    REQUIRE (Utils::getSourceRevision("/tmp/higgs-boson/revision-test") == "unknown");
+
+    // Verify the commit hash of a clean git repository
+    REQUIRE (system(std::string("cd /tmp/higgs-boson/revision-test && git init -q && echo 1 > file.txt && git add file.txt"
+            " && git -c user.name=test -c user.email=test@test.com commit -q -m test").c_str()) == 0);
+    auto commitHash = ExecShell::exec("git -C /tmp/higgs-boson/revision-test rev-parse --short HEAD");
+    REQUIRE (Utils::getSourceRevision("/tmp/higgs-boson/revision-test") == Utils::trim(commitHash));
+
+    // Verify uncommitted changes are marked as dirty
+    REQUIRE (system(std::string("echo 2 > /tmp/higgs-boson/revision-test/file.txt").c_str()) == 0);
+    REQUIRE (Utils::getSourceRevision("/tmp/higgs-boson/revision-test") == (commitHash + "-dirty"));
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/revision-test").c_str()) == 0);
+}
+
+TEST_CASE ("Changed Files Test", "[UtilsTest]")
+{
+
+    // Setup a git repository with a committed base
+    REQUIRE (system(std::string("mkdir -p /tmp/higgs-boson/changed-test/src").c_str()) == 0);
+    REQUIRE (system(std::string("cd /tmp/higgs-boson/changed-test && git init -q"
+            " && echo 1 > src/a.cpp && echo 1 > src/b.cpp && echo 1 > src/c.cpp && echo 1 > other.txt"
+            " && git add . && git -c user.name=test -c user.email=test@test.com commit -q -m base").c_str()) == 0);
+
+    // Verify an unchanged repository has no changed files
+    std::vector<std::string> changedFiles;
+    REQUIRE (Utils::getChangedFiles("/tmp/higgs-boson/changed-test/src", "HEAD", changedFiles));
+    REQUIRE (changedFiles.empty());
+
+    // Commit, modify, add, and delete files against the base
+    REQUIRE (system(std::string("cd /tmp/higgs-boson/changed-test && echo 2 > src/a.cpp"
+            " && git -c user.name=test -c user.email=test@test.com commit -q -am change"
+            " && echo 2 > src/b.cpp && echo 1 > src/d.cpp && rm src/c.cpp && echo 2 > other.txt").c_str()) == 0);
+
+    // Verify only the existing changed files within the directory are listed
+    REQUIRE (Utils::getChangedFiles("/tmp/higgs-boson/changed-test/src", "HEAD~1", changedFiles));
+    REQUIRE (changedFiles.size() == 3);
+    REQUIRE (changedFiles[0] == "/tmp/higgs-boson/changed-test/src/a.cpp");
+    REQUIRE (changedFiles[1] == "/tmp/higgs-boson/changed-test/src/b.cpp");
+    REQUIRE (changedFiles[2] == "/tmp/higgs-boson/changed-test/src/d.cpp");
+
+    // Verify unknown (or unfetched) references are reported as failures
+    REQUIRE (Utils::isGitCommit("/tmp/higgs-boson/changed-test/src", "HEAD~1"));
+    REQUIRE (!Utils::isGitCommit("/tmp/higgs-boson/changed-test/src", "unknown-ref"));
+    REQUIRE (!Utils::isGitCommit("/tmp/higgs-boson/changed-test/src", "HEAD~5"));
+    REQUIRE (!Utils::getChangedFiles("/tmp/higgs-boson/changed-test/src", "unknown-ref", changedFiles));
+    REQUIRE (changedFiles.empty());
+
+    // Cleanup the temporary files
+    REQUIRE (system(std::string("rm -rf /tmp/higgs-boson/changed-test").c_str()) == 0);
+}
+
+TEST_CASE ("Command-Line Arguments Test", "[UtilsTest]")
+{
+
+    // Verify named options and flags are extracted (leaving the positional arguments)
+    char testArgs[][16] = {"higgs-boson", "test", "--parallel", "4", "--affected", "HEAD"};
+    char* testArgv[] = {testArgs[0], testArgs[1], testArgs[2], testArgs[3], testArgs[4], testArgs[5], nullptr};
+    int testArgc = 6;
+    REQUIRE (Utils::extractCommandLineOption(testArgc, testArgv, "--parallel") == "4");
+    REQUIRE (Utils::extractCommandLineFlag(testArgc, testArgv, "--affected"));
+    REQUIRE (!Utils::extractCommandLineFlag(testArgc, testArgv, "--offline"));
+    REQUIRE (Utils::extractCommandLineOption(testArgc, testArgv, "--base").empty());
+    REQUIRE (testArgc == 3);
+    REQUIRE (Utils::joinCommandLineArgs(testArgc, testArgv, 1) == "test HEAD ");
+
+    // Verify the arguments of the run command are passed through unchanged
+    // (including those which match the named options of other commands)
+    char runArgs[][16] = {"higgs-boson", "run", "--profile", "x", "--cache"};
+    char* runArgv[] = {runArgs[0], runArgs[1], runArgs[2], runArgs[3], runArgs[4], nullptr};
+    REQUIRE (Utils::joinCommandLineArgs(5, runArgv, 2) == "--profile x --cache ");
+
+    // Verify the arguments of the cmd command are passed through unchanged
+    char cmdArgs[][16] = {"higgs-boson", "cmd", "tool", "--cache", "--parallel", "2"};
+    char* cmdArgv[] = {cmdArgs[0], cmdArgs[1], cmdArgs[2], cmdArgs[3], cmdArgs[4], cmdArgs[5], nullptr};
+    REQUIRE (Utils::joinCommandLineArgs(6, cmdArgv, 2) == "tool --cache --parallel 2 ");
+}
+
+TEST_CASE ("Mann-Whitney U P-Value Test", "[UtilsTest]")
+{
+
+    // Verify completely separated samples are significantly different
+    REQUIRE (Utils::mannWhitneyPValue({1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
+            {11, 12, 13, 14, 15, 16, 17, 18, 19, 20}) == Approx(0.000182672).epsilon(0.001));
+
+    // Verify interleaved samples are not significantly different
+    REQUIRE (Utils::mannWhitneyPValue({1, 3, 5, 7, 9}, {2, 4, 6, 8, 10}) == Approx(0.676103).epsilon(0.001));
+
+    // Verify tied values are ranked (and corrected for) properly
+    REQUIRE (Utils::mannWhitneyPValue({1, 2, 2, 3}, {2, 3, 3, 4}) == Approx(0.172034).epsilon(0.001));
+
+    // Verify the test is symmetric in its samples
+    REQUIRE (Utils::mannWhitneyPValue({2, 3, 3, 4}, {1, 2, 2, 3}) == Approx(0.172034).epsilon(0.001));
+
+    // Verify identical, constant, and empty samples are not significant
+    REQUIRE (Utils::mannWhitneyPValue({1, 2, 3}, {1, 2, 3}) == Approx(1.0));
+    REQUIRE (Utils::mannWhitneyPValue({5, 5, 5}, {5, 5, 5}) == Approx(1.0));
+    REQUIRE (Utils::mannWhitneyPValue({}, {1, 2, 3}) == Approx(1.0));
+}
+
 #endif //HIGGS_BOSON_UTILS_TEST_HPP